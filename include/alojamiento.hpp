@@ -4,35 +4,39 @@
 #include <stdint.h>
 #include <cstddef>  // Para size_t
 #include "reserva.hpp"
-#include "linked_list.hpp"
+#include "intrusive_list.hpp"
+#include "arena_cadenas.hpp"
+#include "calendario_ocupacion.hpp"
+#include "indice_reservas.hpp"
 /**
  * @class Alojamiento
  * @brief Representa un alojamiento en una plataforma de alquiler.
  * 
  * Esta clase gestiona información básica como nombre, dirección, código,
  * ubicación y tipo de alojamiento, así como el identificador del responsable.
+ * Los textos se guardan en la arena del conjunto de datos cargado, que es quien los libera.
  */
 class Alojamiento {
 private:
     uint32_t m_id;                ///< ID del alojamiento.
     uint64_t m_codigo_anfitrion;  ///< Código del anfitrión.
-    char* m_nombre;              ///< Nombre del alojamiento.
-    char* m_direccion;           ///< Dirección del alojamiento.
-    char* m_departamento;        ///< Departamento del alojamiento.
-    char* m_municipio;          ///< Municipio del alojamiento.
+    Cadena m_nombre;             ///< Nombre del alojamiento.
+    Cadena m_direccion;          ///< Dirección del alojamiento.
+    Cadena m_departamento;       ///< Departamento del alojamiento.
+    Cadena m_municipio;          ///< Municipio del alojamiento.
     uint8_t m_tipo;              ///< Tipo de alojamiento (1 = Casa, 2 = Apartamento).
+    bool m_reservas_solapadas;   ///< Indica si los archivos trajeron reservas que se cruzan entre sí.
     float m_precio;             ///< Precio por noche
-    char* m_amenidades;         ///< Amenidades del alojamiento.
-    Linked_List<Reserva*> *m_reservas; ///< Lista de reservas de un alojamiento (si aplica).
+    Cadena m_amenidades;        ///< Amenidades del alojamiento.
+    Intrusive_List<Reserva> m_reservas; ///< Lista de reservas de un alojamiento, enlazadas por la propia reserva.
+    Calendario_Ocupacion m_calendario;  ///< Noches ocupadas por las reservas de la lista.
+    mutable Indice_Reservas m_indice;   ///< Reservas por fecha de entrada; se reconstruye al consultar tras un cambio.
 
     /**
-     * @brief Copia una cadena de caracteres a memoria dinámica.
-     * 
-     * @param data Cadena de caracteres a copiar.
-     * @param len Longitud de la cadena (incluyendo el terminador nulo).
-     * @return Puntero a la nueva cadena copiada, o nullptr si falla.
+     * @brief Marca las noches de una reserva en el calendario y anota si ya estaban ocupadas.
+     * @param reserva Reserva a marcar.
      */
-    char* copy_data(const char* data, size_t len);
+    void marcar_en_calendario(const Reserva &reserva);
 
 public:
     /**
@@ -48,14 +52,22 @@ public:
      * @param tipo Tipo de alojamiento (1 = Casa, 2 = Apartamento).
      * @param precio Precio por una noche en el alojamiento.
      * @param amenidades Conjunto de ameneidades que tiene el alojamiento.
+     * @param arena Arena donde se copian los textos; debe vivir más que el alojamiento.
      */
 
     Alojamiento(uint32_t id, const char* nombre, uint64_t codigo_anfitrion,
                 const char* direccion, const char* departamento,
-                const char* municipio, uint8_t tipo, float precio, const char* amenidades);
+                const char* municipio, uint8_t tipo, float precio, const char* amenidades,
+                Arena_Cadenas *arena);
 
     
     
+    /**
+     * @brief Activa el calendario de ocupación a partir de una fecha y marca las reservas que ya tiene.
+     * @param base Primer día del calendario (la fecha del sistema).
+     */
+    void iniciar_calendario(const Fecha &base);
+
     /**
      * @brief Agrega una reserva activa al alojamiento
      * @return ID del alojamiento.
@@ -71,6 +83,9 @@ public:
 
     /**
      * @breif Muestra las reservas activas del alojamiento en un rango de fechas.
+     *
+     * Las busca en el índice por fecha de entrada, en orden de entrada, sin recorrer las que
+     * terminaron mucho antes del rango.
      * @brief desde Fecha de inicio.
      * @brief hasta Fecha de fin.
      */
@@ -85,6 +100,9 @@ public:
     
     /**
      * @brief Valida si el alojamiento tiene reservas activas en un rango de fechas.
+     *
+     * Si el rango cae en el calendario de ocupación responde con unas pocas palabras del mapa de
+     * bits; si no, recorre la lista de reservas.
      * @param desde Fecha de inicio.
      * @param hasta Fecha de fin.
      * @return true si no hay reservas activas, false en caso contrario.
@@ -102,20 +120,17 @@ public:
     void mostrar_alojamiento() const;
 
     /**
-     * @brief Verifica si hay reservas activas en un rango de fechas.
-     * @param desde Fecha de inicio.
-     * @param hasta Fecha de fin.
-     * @param dpto Departamento del alojamiento.
-     * @return true si hay reservas activas, false en caso contrario.
+     * @brief Obtiene el municipio del alojamiento.
+     * @return Municipio del alojamiento.
      */
-    bool es_candidato_reserva(const Fecha &desde, const Fecha &hasta, const std::string &dpto) const;
+    const Cadena &get_municipio() const;
     
     /**
-     * @brief Elimina una reserva del alojamiento.
-     * @param codigo_reserva Código de la reserva a eliminar.
-     * @return true si la reserva fue eliminada, false en caso contrario.
+     * @brief Elimina una reserva del alojamiento en O(1), sin recorrer su lista.
+     * @param reserva Reserva a eliminar.
+     * @return true si la reserva fue eliminada, false si no era de este alojamiento.
      */
-    bool eliminar_reserva(uint32_t codigo_reserva);
+    bool eliminar_reserva(Reserva *reserva);
     
     /**
      * @brief Obtiene el nombre del alojamiento.
@@ -125,7 +140,7 @@ public:
     /**
      * @brief Destructor.
      * 
-     * Libera toda la memoria dinámica utilizada.
+     * Los textos no se liberan aquí: se van con la arena.
      * 
      */
     ~Alojamiento();
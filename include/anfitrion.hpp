@@ -2,8 +2,10 @@
 #define __ANFITRION_HPP__
 #include <stdint.h>
 #include <string>
-#include "linked_list.hpp"
+#include "small_vector.hpp"
 #include "alojamiento.hpp"
+
+#define ALOJAMIENTOS_POR_ANFITRION 4 // Alojamientos que caben en el anfitrión sin pedir memoria
 /**
  * @class Anfitrion
  * @brief Clase que representa a un anfitrion con información personal y de acceso.
@@ -104,7 +106,7 @@ class Anfitrion
         char * m_password;         ///< Contraseña del anfitrion.
         uint16_t m_antiguedad;     ///< Antigüedad del anfitrion en meses.
         float m_puntuacion;        ///< Puntuación del usuario.
-        Linked_List<Alojamiento*> *m_alojamientos; ///< Lista de reservas del anfitrion.
+        Small_Vector<Alojamiento*, ALOJAMIENTOS_POR_ANFITRION> m_alojamientos; ///< Alojamientos del anfitrion.
 };
 
 #endif
\ No newline at end of file
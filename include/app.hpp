@@ -14,10 +14,15 @@
 #define RESERVAS_FILE "reservaciones.txt"
 #define HISTORICO_FILE "historico.txt"
 #define CANCELACIONES_FILE "cancelaciones.txt"
+#define ESTADISTICAS_FILE "estadisticas_mapas.json" // Solo se escribe si se compila con ESTADISTICAS_JSON
 #define ESTA_ACTIVA(fin, sistema) (fin > sistema) // Verifica si la reserva está activa
 #define MAX_NOCHES_RESERVA 365
 #define LONG_ANOTACIONES 1000
 #define DEFAULT_NUMERO_RESERVAS 10
+#define LOTE_BUSQUEDAS 64 // Claves que se resuelven juntas con find_many al cruzar mapas
+#define CANDIDATOS_LOCALES 32 // Alojamientos candidatos que caben en la pila al buscar sin pedir memoria
+#define LONG_CAMPOS_RESERVA 128 // Caracteres de una línea de reserva sin contar las anotaciones
+#define LINEAS_LOTE_RESERVAS LOTE_FECHAS // Líneas de reservas cuyas fechas se validan en una sola llamada a cargar_lote
 #include <iostream>
 #include <fstream>
 #include <cstring>
@@ -27,25 +32,25 @@
 #include "huesped.hpp"
 #include "anfitrion.hpp"
 #include "unordered_map.hpp"
+#include "owning_unordered_map.hpp"
 #include "fecha.hpp"
 #include "reserva.hpp"
 #include "linked_list.hpp"
+#include "small_vector.hpp"
+#include "formato.hpp"
+#include "tabla_reservas.hpp"
+#include "indice_municipios.hpp"
 #include <limits>
 
-struct callback_param_historico {
-    std::ofstream* archivo;
-    Fecha* fecha;
-    Anfitrion* anfitrion;
-    Linked_List<Reserva*>* historico;
-};
-
-struct callback_param_reservacion {
-    Fecha *inicio;
-    Fecha *fin;
-    std::string *mpo;
-    Linked_List<Alojamiento*>* alojamientos;
-    Linked_List<Alojamiento*>* alojamientos_disponibles;
-};
+/**
+ * @brief Tipos de los mapas que mantiene la aplicación en memoria.
+ * Cambiar el motor de un mapa solo requiere modificar su typedef.
+ * Los mapas son dueños de sus objetos: se crean con emplace() y se destruyen con erase().
+ */
+typedef Owning_Unordered_Map<uint32_t, Reserva> Mapa_Reservas;          ///< Reservas indexadas por código de reserva.
+typedef Owning_Unordered_Map<uint32_t, Alojamiento> Mapa_Alojamientos;  ///< Alojamientos indexados por código.
+typedef Owning_Unordered_Map<uint64_t, Anfitrion> Mapa_Anfitriones;     ///< Anfitriones indexados por documento.
+typedef Small_Vector<Alojamiento*, CANDIDATOS_LOCALES> Lista_Alojamientos; ///< Alojamientos candidatos de una búsqueda.
 
 void app_main(void);
 #endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+#ifndef __ARENA_CADENAS_HPP__
+#define __ARENA_CADENAS_HPP__
+#include <stdint.h>
+#include <cstddef>
+
+#define TAM_BLOQUE_ARENA 65536 // Bytes de cada bloque de la arena
+#define CADENA_GRANDE_ARENA (TAM_BLOQUE_ARENA / 4) // Cadenas de este tamaño o más van en un bloque propio
+
+/**
+ * @class Cadena
+ * @brief Referencia liviana a una cadena guardada en una Arena_Cadenas (puntero y longitud).
+ *
+ * No es dueña del texto: deja de ser válida cuando la arena se reinicia o se destruye.
+ */
+class Cadena
+{
+    public:
+        /**
+         * @brief Constructor por defecto. La cadena es nula (c_str() devuelve nullptr).
+         */
+        Cadena();
+
+        /**
+         * @brief Constructor.
+         * @param datos Texto terminado en '\0'.
+         * @param longitud Longitud del texto sin el terminador.
+         */
+        Cadena(const char *datos, uint32_t longitud);
+
+        /**
+         * @brief Obtiene el texto terminado en '\0', o nullptr si la cadena es nula.
+         */
+        const char *c_str() const;
+
+        /**
+         * @brief Obtiene la longitud del texto sin el terminador.
+         */
+        uint32_t size() const;
+
+    private:
+        const char *m_datos;   ///< Texto dentro de la arena.
+        uint32_t m_longitud;   ///< Longitud sin el terminador.
+};
+
+/**
+ * @class Arena_Cadenas
+ * @brief Asignador de cadenas por avance de puntero (bump allocator).
+ *
+ * Copia cada cadena a continuación de la anterior dentro de bloques grandes, así guardar una
+ * cadena no pide memoria al sistema salvo cuando se llena un bloque. Las cadenas no se liberan
+ * una por una: reset() devuelve todos los bloques de una vez al terminar la sesión.
+ */
+class Arena_Cadenas
+{
+    public:
+        Arena_Cadenas(const Arena_Cadenas&) = delete; ///< Elimina el constructor de copia.
+        Arena_Cadenas& operator=(const Arena_Cadenas&) = delete; ///< Elimina el operador de asignación.
+
+        /**
+         * @brief Constructor. No reserva memoria hasta la primera cadena.
+         */
+        Arena_Cadenas();
+
+        /**
+         * @brief Destructor. Libera todos los bloques.
+         */
+        ~Arena_Cadenas();
+
+        /**
+         * @brief Copia un texto a la arena.
+         * @param texto Texto a copiar (puede no estar terminado en '\0').
+         * @param longitud Longitud del texto.
+         * @return Referencia a la copia, terminada en '\0'.
+         */
+        Cadena copiar(const char *texto, size_t longitud);
+
+        /**
+         * @brief Copia un texto terminado en '\0' a la arena.
+         * @param texto Texto a copiar, o nullptr.
+         * @return Referencia a la copia, o una cadena nula si texto es nullptr.
+         */
+        Cadena copiar(const char *texto);
+
+        /**
+         * @brief Libera todos los bloques. Las cadenas entregadas dejan de ser válidas.
+         */
+        void reset();
+
+        /**
+         * @brief Obtiene los bytes reservados por la arena.
+         */
+        size_t get_bytes() const;
+
+        /**
+         * @brief Obtiene los bytes ocupados por cadenas.
+         */
+        size_t get_usados() const;
+
+    private:
+        /**
+         * @brief Cabecera de cada bloque; el espacio para las cadenas va justo después.
+         */
+        struct Bloque {
+            Bloque *siguiente; ///< Bloque reservado antes que este.
+        };
+
+        Bloque *m_bloques;   ///< Lista de bloques reservados.
+        char *m_libre;       ///< Primer byte libre del bloque actual.
+        char *m_fin;         ///< Fin del bloque actual.
+        size_t m_bytes;      ///< Bytes reservados.
+        size_t m_usados;     ///< Bytes ocupados por cadenas.
+
+        /**
+         * @brief Reserva un bloque y lo enlaza en la lista.
+         * @param capacidad Bytes para cadenas que tendrá el bloque.
+         * @return Inicio del espacio para cadenas.
+         */
+        char *nuevo_bloque(size_t capacidad);
+};
+
+#endif
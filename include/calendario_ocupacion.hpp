@@ -0,0 +1,72 @@
+#ifndef __CALENDARIO_OCUPACION_HPP__
+#define __CALENDARIO_OCUPACION_HPP__
+#include <stdint.h>
+#include "fecha.hpp"
+
+#define DIAS_CALENDARIO 768 // Días que cubre el calendario: una reserva empieza a menos de un año y dura a lo sumo otro
+#define BITS_PALABRA_CALENDARIO 64 // Días por palabra del mapa de bits
+#define PALABRAS_CALENDARIO (DIAS_CALENDARIO / BITS_PALABRA_CALENDARIO) // Palabras del mapa de bits
+
+/**
+ * @class Calendario_Ocupacion
+ * @brief Mapa de bits con los días ocupados de un alojamiento a partir de un día base.
+ *
+ * El bit i indica si la noche del día base + i está reservada. Saber si un rango está libre es
+ * hacer AND con una máscara en cada palabra que toca el rango: a lo sumo PALABRAS_CALENDARIO
+ * operaciones, sin importar cuántas reservas tenga el alojamiento. Los rangos que se salen de
+ * la ventana no se pueden responder aquí (cubre() devuelve false) y el llamador debe recorrer
+ * las reservas.
+ */
+class Calendario_Ocupacion
+{
+    public:
+        /**
+         * @brief Constructor. El calendario empieza inactivo y no cubre ningún día.
+         */
+        Calendario_Ocupacion();
+
+        /**
+         * @brief Activa el calendario con todos los días libres a partir de una fecha.
+         * @param base Primer día de la ventana.
+         */
+        void iniciar(const Fecha &base);
+
+        /**
+         * @brief Indica si el rango [desde, hasta) cae completo dentro de la ventana.
+         */
+        bool cubre(const Fecha &desde, const Fecha &hasta) const;
+
+        /**
+         * @brief Marca como ocupada la parte del rango [desde, hasta) que cae en la ventana.
+         */
+        void marcar(const Fecha &desde, const Fecha &hasta);
+
+        /**
+         * @brief Marca como libre la parte del rango [desde, hasta) que cae en la ventana.
+         */
+        void liberar(const Fecha &desde, const Fecha &hasta);
+
+        /**
+         * @brief Indica si ninguna noche del rango [desde, hasta) está ocupada.
+         * @pre cubre(desde, hasta) es true.
+         */
+        bool libre(const Fecha &desde, const Fecha &hasta) const;
+
+    private:
+        uint64_t m_bits[PALABRAS_CALENDARIO]; ///< Un bit por noche de la ventana.
+        int32_t m_dia_base;                   ///< Día serial del bit 0.
+        bool m_activo;                        ///< Indica si se llamó a iniciar().
+
+        /**
+         * @brief Recorta el rango a la ventana y lo pasa a índices de bit [inicio, fin).
+         * @return false si el rango no toca la ventana.
+         */
+        bool recortar(const Fecha &desde, const Fecha &hasta, int32_t &inicio, int32_t &fin) const;
+
+        /**
+         * @brief Máscara de los bits [inicio, fin) que caen en la palabra indicada.
+         */
+        static uint64_t mascara(uint32_t palabra, int32_t inicio, int32_t fin);
+};
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef __CONCURRENT_UNORDERED_MAP_HPP__
+#define __CONCURRENT_UNORDERED_MAP_HPP__
+
+#include <cstddef>
+#include <shared_mutex>
+#include <stdint.h>
+#include "unordered_map.hpp"
+
+/**
+ * @brief Mapa no ordenado para acceso desde varios hilos, dividido en segmentos (shards).
+ *
+ * Cada segmento es un Unordered_Map con su propio std::shared_mutex. La clave elige el segmento
+ * con los bits altos de su hash (el Unordered_Map usa los bajos), así que operaciones sobre claves
+ * de segmentos distintos no compiten por el mismo candado:
+ * - find() toma el candado compartido del segmento y usa la búsqueda const del mapa, que no migra
+ *   casillas; los lectores de un mismo segmento avanzan en paralelo.
+ * - insert() y erase() toman el candado exclusivo solo de su segmento.
+ *
+ * El mapa no es dueño de los valores. find() suelta el candado antes de devolver el puntero, así
+ * que ese puntero solo es seguro si ningún hilo puede hacer erase() de la clave y liberar el
+ * valor mientras se usa. Cuando otros hilos borran, el valor se lee con consultar(), que corre
+ * la función con el candado compartido tomado; quien hace erase() libera el valor después, ya
+ * fuera del candado, y ningún lector puede seguir usándolo.
+ *
+ * Los contadores de performance.hpp son por hilo, así que los lectores de un segmento no escriben
+ * memoria compartida mientras buscan.
+ *
+ * @tparam Key Tipo de la clave.
+ * @tparam Value Tipo del valor asociado a cada clave.
+ * @tparam Hash Política de hash e igualdad de las claves.
+ * @tparam Segmentos Número de segmentos (potencia de dos).
+ */
+template <typename Key, typename Value, typename Hash = Hash_Policy<Key>, size_t Segmentos = 16>
+class Concurrent_Unordered_Map {
+    static_assert(Segmentos > 0 && (Segmentos & (Segmentos - 1)) == 0, "Segmentos debe ser potencia de dos");
+
+    private:
+        /**
+         * @brief Segmento del mapa. Se alinea a una línea de caché para que los candados de
+         * segmentos vecinos no compartan línea.
+         */
+        struct alignas(64) segmento {
+            mutable std::shared_mutex candado;         ///< Candado del segmento.
+            Unordered_Map<Key, Value, Hash> *mapa;     ///< Elementos del segmento.
+        };
+
+        segmento m_segmentos[Segmentos]; ///< Segmentos del mapa.
+
+        /**
+         * @brief Elige el segmento de una clave.
+         *
+         * @param key Clave a ubicar.
+         * @return Segmento responsable de la clave.
+         */
+        segmento &segmento_de(const Key& key);
+        const segmento &segmento_de(const Key& key) const;
+
+    public:
+        Concurrent_Unordered_Map(const Concurrent_Unordered_Map&) = delete; ///< Elimina el constructor de copia.
+        Concurrent_Unordered_Map& operator=(const Concurrent_Unordered_Map&) = delete; ///< Elimina el operador de asignación.
+
+        /**
+         * @brief Constructor. Reparte la capacidad esperada entre los segmentos.
+         * @param size Número de elementos que se espera almacenar.
+         */
+        Concurrent_Unordered_Map(size_t size);
+
+        /**
+         * @brief Destructor. Libera los segmentos; los valores los libera clear_values().
+         */
+        ~Concurrent_Unordered_Map();
+
+        /**
+         * @brief Inserta o actualiza un par clave-valor con el candado exclusivo de su segmento.
+         *
+         * @param key Clave que se desea insertar.
+         * @param value Valor asociado a la clave.
+         */
+        void insert(const Key& key, Value *value);
+
+        /**
+         * @brief Busca un valor con el candado compartido de su segmento.
+         *
+         * El candado se suelta al retornar: el puntero deja de ser válido si otro hilo borra la
+         * clave y libera el valor. Con borrados concurrentes se debe usar consultar().
+         *
+         * @param key La clave para la cual se desea encontrar el valor.
+         * @return Un puntero al valor asociado a la clave, o nullptr si no se encuentra.
+         */
+        Value* find(const Key& key) const;
+
+        /**
+         * @brief Busca un valor y le aplica una función sin soltar el candado compartido.
+         *
+         * Mientras la función corre ningún escritor puede borrar la clave, así que el valor no
+         * se libera debajo del lector. La función no debe modificar el mapa ni guardar la referencia.
+         *
+         * @param key La clave a buscar.
+         * @param funcion Función que recibe const Value&.
+         * @return true si la clave estaba y se aplicó la función.
+         */
+        template <typename F>
+        bool consultar(const Key& key, F&& funcion) const;
+
+        /**
+         * @brief Elimina un par clave-valor con el candado exclusivo de su segmento.
+         *
+         * @param key Clave del elemento que se desea eliminar.
+         * @return Un puntero al valor eliminado o nullptr si no se encuentra. Será liberado por el
+         *         llamador; si otros hilos usan find() sobre la misma clave, pueden tener todavía ese
+         *         puntero (ver consultar()).
+         */
+        Value *erase(const Key& key);
+
+        /**
+         * @brief Garantiza capacidad para al menos n elementos repartidos entre los segmentos.
+         *
+         * @param n Número de elementos que se espera almacenar.
+         */
+        void reserve(size_t n);
+
+        /**
+         * @brief Devuelve el número de elementos. Con escritores activos es solo una instantánea.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Libera los valores de todos los segmentos. No debe haber otros hilos usando el mapa.
+         */
+        void clear_values();
+
+        /**
+         * @brief Aplica una función a cada par clave-valor, segmento por segmento, con el candado
+         * compartido del segmento que se recorre. La función no debe modificar el mapa.
+         *
+         * @param funcion Función que recibe (clave, valor). Si devuelve bool, false detiene el recorrido.
+         * @return true si se recorrieron todos los segmentos.
+         */
+        template <typename F>
+        bool for_each(F&& funcion) const;
+};
+
+#include "concurrent_unordered_map.tpp"
+#endif
@@ -0,0 +1,139 @@
+#ifndef __CONCURRENT_UNORDERED_MAP_TPP__
+#define __CONCURRENT_UNORDERED_MAP_TPP__
+
+#include <mutex>
+#include <shared_mutex>
+#include <stdint.h>
+#include "concurrent_unordered_map.hpp"
+
+/**
+ * @brief Constructor. Cada segmento arranca con la parte proporcional de la capacidad.
+ */
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::Concurrent_Unordered_Map(size_t size)
+{
+    for (size_t i = 0; i < Segmentos; ++i)
+        m_segmentos[i].mapa = new Unordered_Map<Key, Value, Hash>(size / Segmentos + 1);
+}
+
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::~Concurrent_Unordered_Map()
+{
+    for (size_t i = 0; i < Segmentos; ++i) {
+        delete m_segmentos[i].mapa;
+        m_segmentos[i].mapa = nullptr;
+    }
+}
+
+/**
+ * @brief Elige el segmento con los bits altos del hash remezclado (Fibonacci). Los bits bajos
+ * los usa la máscara del Unordered_Map, así que no se repiten entre segmento y casilla.
+ */
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+typename Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::segmento &
+Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::segmento_de(const Key& key)
+{
+    return const_cast<segmento&>(static_cast<const Concurrent_Unordered_Map*>(this)->segmento_de(key));
+}
+
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+const typename Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::segmento &
+Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::segmento_de(const Key& key) const
+{
+    if constexpr (Segmentos == 1)
+        return m_segmentos[0];
+
+    constexpr unsigned bits = __builtin_ctzll(Segmentos);
+    uint64_t h = static_cast<uint64_t>(Hash::hash(key)) * 0x9E3779B97F4A7C15ULL;
+    return m_segmentos[h >> (64 - bits)];
+}
+
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+void Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::insert(const Key& key, Value *value)
+{
+    segmento &s = segmento_de(key);
+    std::unique_lock<std::shared_mutex> candado(s.candado);
+    s.mapa->insert(key, value);
+}
+
+/**
+ * @brief Búsqueda con candado compartido. Usa Unordered_Map::find() const, que no migra
+ * casillas, así que varios lectores pueden estar dentro del mismo segmento.
+ */
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+Value* Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::find(const Key& key) const
+{
+    const segmento &s = segmento_de(key);
+    std::shared_lock<std::shared_mutex> candado(s.candado);
+    const Unordered_Map<Key, Value, Hash> *mapa = s.mapa;
+    return mapa->find(key);
+}
+
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+template <typename F>
+bool Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::consultar(const Key& key, F&& funcion) const
+{
+    const segmento &s = segmento_de(key);
+    std::shared_lock<std::shared_mutex> candado(s.candado);
+    const Unordered_Map<Key, Value, Hash> *mapa = s.mapa;
+    const Value *valor = mapa->find(key);
+    if (valor == nullptr)
+        return false;
+
+    funcion(*valor);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+Value *Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::erase(const Key& key)
+{
+    segmento &s = segmento_de(key);
+    std::unique_lock<std::shared_mutex> candado(s.candado);
+    return s.mapa->erase(key);
+}
+
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+void Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::reserve(size_t n)
+{
+    for (size_t i = 0; i < Segmentos; ++i) {
+        std::unique_lock<std::shared_mutex> candado(m_segmentos[i].candado);
+        m_segmentos[i].mapa->reserve(n / Segmentos + 1);
+    }
+}
+
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+size_t Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::size() const
+{
+    size_t total = 0;
+    for (size_t i = 0; i < Segmentos; ++i) {
+        std::shared_lock<std::shared_mutex> candado(m_segmentos[i].candado);
+        total += m_segmentos[i].mapa->size();
+    }
+    return total;
+}
+
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+void Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::clear_values()
+{
+    for (size_t i = 0; i < Segmentos; ++i) {
+        std::unique_lock<std::shared_mutex> candado(m_segmentos[i].candado);
+        m_segmentos[i].mapa->clear_values();
+    }
+}
+
+/**
+ * @brief Recorre los segmentos en orden, cada uno bajo su candado compartido.
+ */
+template <typename Key, typename Value, typename Hash, size_t Segmentos>
+template <typename F>
+bool Concurrent_Unordered_Map<Key, Value, Hash, Segmentos>::for_each(F&& funcion) const
+{
+    for (size_t i = 0; i < Segmentos; ++i) {
+        std::shared_lock<std::shared_mutex> candado(m_segmentos[i].candado);
+        if (!m_segmentos[i].mapa->for_each(funcion))
+            return false;
+    }
+    return true;
+}
+
+#endif
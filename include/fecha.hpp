@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <cstddef>
+#include <type_traits>
 
 
 #define LONG_FECHA_CADENA 10
@@ -14,19 +15,48 @@
 #define DIA_DEFECTO 1
 #define MES_DEFECTO 1
 #define ANIO_DEFECTO 1970
+#define DIA_SEMANA_EPOCA 4 // El 01/01/1970 fue jueves (0=Domingo)
+#define ANIO_TABLA_MIN 1900 // Primer año de la tabla de calendario
+#define ANIO_TABLA_MAX 2200 // Último año de la tabla de calendario
+#define LOTE_FECHAS 16      // Fechas que cargar_lote valida por tanda
 
 /**
  * @class Fecha
  * @brief Clase que representa una fecha con día, mes y año.
  *
+ * Internamente la fecha es un número de día serial (días desde el 01/01/1970), así que
+ * comparar es restar dos enteros, sumar noches es una suma y el día de la semana es un módulo.
+ * El día, mes y año se calculan en O(1) solo cuando se necesitan (para mostrar o validar):
+ * entre ANIO_TABLA_MIN y ANIO_TABLA_MAX salen de una tabla de calendario construida en tiempo
+ * de compilación; fuera de ese rango se calculan con aritmética de eras.
+ *
+ * Es un tipo valor trivialmente copiable de 4 bytes: se pasa y se devuelve por valor y se guarda
+ * embebido en los objetos que la usan, sin pedir memoria al heap.
+ *
  * Proporciona métodos para validación, comparación, conversión y
  * operaciones con fechas como suma de noches.
  */
 class Fecha {
 private:
-    uint8_t dia;   ///< Día del mes 
-    uint8_t mes;   ///< Mes del año 
-    int16_t anio;  ///< Año
+    int32_t serial; ///< Días transcurridos desde el 01/01/1970 (negativo antes).
+
+    /**
+     * @brief Convierte una fecha civil a su número de día serial.
+     * @param d Día.
+     * @param m Mes.
+     * @param a Año.
+     * @return Días desde el 01/01/1970.
+     */
+    static int32_t dias_desde_civil(uint8_t d, uint8_t m, int16_t a);
+
+    /**
+     * @brief Convierte un número de día serial a fecha civil.
+     * @param dias Días desde el 01/01/1970.
+     * @param d Día resultante.
+     * @param m Mes resultante.
+     * @param a Año resultante.
+     */
+    static void civil_desde_dias(int32_t dias, uint8_t &d, uint8_t &m, int16_t &a);
 
     /**
      * @brief Verifica si un año es bisiesto.
@@ -70,6 +100,19 @@ public:
      */
     Fecha(uint8_t d, uint8_t m, int16_t a);
 
+    /**
+     * @brief Construye una fecha a partir de su número de día serial.
+     * @param dia Días desde el 01/01/1970.
+     * @return Fecha correspondiente.
+     */
+    static Fecha desde_dia_serial(int32_t dia);
+
+    /**
+     * @brief Obtiene el número de día serial de la fecha.
+     * @return Días desde el 01/01/1970.
+     */
+    int32_t get_dia_serial() const;
+
     /**
      * @brief Asigna una nueva fecha si es válida.
      * @param d Día.
@@ -94,6 +137,15 @@ public:
      */
     bool cargar_desde_cadena(const char* cadena);
 
+    /**
+     * @brief Carga varias fechas "DD/MM/AAAA" de una vez, validándolas en registros vectoriales.
+     * @param cadenas Cadenas de entrada.
+     * @param fechas Fechas destino; las que tengan una cadena inválida no se modifican.
+     * @param n Número de cadenas.
+     * @return Número de fechas válidas cargadas.
+     */
+    static uint32_t cargar_lote(const char *const *cadenas, Fecha *fechas, uint32_t n);
+
     
     /// Operador de igualdad.
     bool operator==(const Fecha& otra) const;
@@ -118,7 +170,7 @@ public:
      * @param noches Número de noches (días) a sumar.
      * @return Nueva fecha resultante.
      */
-    Fecha *sumar_noches(uint16_t noches) const;
+    Fecha sumar_noches(uint16_t noches) const;
 
     /**
      * @brief Muestra la fecha en formato "DD/MM/AAAA".
@@ -137,22 +189,16 @@ public:
      * @brief Agrega años a la fecha actual y entrega una nueva fecha
      * 
      * @param anios Número de años a sumar
-     * @return Fecha* Puntero a una nueva instancia de Fecha con la fecha resultante.
-     *               El usuario es responsable de liberar la memoria.
+     * @return Fecha resultante.
      */
-    Fecha* agregar_anios(uint8_t anios) const;
+    Fecha agregar_anios(uint8_t anios) const;
 
     /**
      * @brief Muestra la fecha en un formato legible.
      */
     void formato_legible() const;
-
-    /**
-     * @brief Destructor de la clase Fecha.
-     * 
-     * No se requiere liberar memoria ya que no se usan punteros dinámicos.
-     */
-    ~Fecha();
 };
 
+static_assert(std::is_trivially_copyable<Fecha>::value, "Fecha debe poder copiarse como un entero");
+
 #endif
@@ -0,0 +1,108 @@
+#ifndef __FORMATO_HPP__
+#define __FORMATO_HPP__
+#include <stdint.h>
+#include <cstddef>
+#include <ostream>
+
+#define LONG_ENTERO_MAX 20        // Dígitos de un uint64_t
+#define LONG_FLOTANTE_MAX 16      // Un float en formato general con 6 cifras, signo y exponente
+#define PRECISION_FLOTANTE 6      // La misma precisión por defecto de std::ostream
+#define TAM_BUFFER_ESCRITOR 16384 // Bytes que acumula Escritor_Lineas antes de escribir al archivo
+
+/**
+ * @brief Escribe un número de 0 a 99 con dos dígitos, copiándolos de una tabla.
+ * @param destino Buffer con espacio para 2 caracteres.
+ * @param valor Número a escribir (menor a 100).
+ * @return Puntero al carácter siguiente al último escrito.
+ */
+char *formato_dos_digitos(char *destino, uint32_t valor);
+
+/**
+ * @brief Escribe una fecha en formato "dd/mm/aaaa", sin el carácter nulo.
+ * @param destino Buffer con espacio para 10 caracteres.
+ * @param dia Día.
+ * @param mes Mes.
+ * @param anio Año (de 0 a 9999).
+ * @return Puntero al carácter siguiente al último escrito.
+ */
+char *formato_fecha(char *destino, uint8_t dia, uint8_t mes, int16_t anio);
+
+/**
+ * @brief Escribe un entero sin signo en decimal con std::to_chars.
+ * @param destino Buffer con espacio para LONG_ENTERO_MAX caracteres.
+ * @param valor Número a escribir.
+ * @return Puntero al carácter siguiente al último escrito.
+ */
+char *formato_entero(char *destino, uint64_t valor);
+
+/**
+ * @brief Escribe un float con std::to_chars, igual que lo haría std::ostream por defecto.
+ * @param destino Buffer con espacio para LONG_FLOTANTE_MAX caracteres.
+ * @param valor Número a escribir.
+ * @return Puntero al carácter siguiente al último escrito.
+ */
+char *formato_flotante(char *destino, float valor);
+
+/**
+ * @class Escritor_Lineas
+ * @brief Acumula texto en un buffer propio y lo pasa al flujo de salida en bloques grandes.
+ *
+ * Las líneas se formatean directamente en el buffer con las funciones formato_*: se pide espacio
+ * con reservar(), se escribe y se confirma hasta dónde se llegó. El flujo solo recibe una
+ * llamada a write() por cada TAM_BUFFER_ESCRITOR bytes.
+ */
+class Escritor_Lineas
+{
+    public:
+        Escritor_Lineas(const Escritor_Lineas&) = delete; ///< Elimina el constructor de copia.
+        Escritor_Lineas& operator=(const Escritor_Lineas&) = delete; ///< Elimina el operador de asignación.
+
+        /**
+         * @brief Constructor.
+         * @param salida Flujo donde se escribe el texto acumulado.
+         */
+        Escritor_Lineas(std::ostream &salida);
+
+        /**
+         * @brief Destructor. Escribe lo que quede pendiente en el buffer.
+         */
+        ~Escritor_Lineas();
+
+        /**
+         * @brief Garantiza espacio libre en el buffer, vaciándolo si hace falta.
+         * @param n Bytes que se van a escribir (a lo sumo TAM_BUFFER_ESCRITOR).
+         * @return Puntero donde se puede escribir.
+         */
+        char *reservar(size_t n);
+
+        /**
+         * @brief Da por escrito el texto desde la posición que entregó reservar() hasta fin.
+         * @param fin Puntero al carácter siguiente al último escrito.
+         */
+        void confirmar(char *fin);
+
+        /**
+         * @brief Copia un texto al buffer; si es más grande que el buffer lo pasa directo al flujo.
+         * @param texto Texto a escribir.
+         * @param n Longitud del texto.
+         */
+        void escribir(const char *texto, size_t n);
+
+        /**
+         * @brief Escribe un carácter.
+         * @param c Carácter a escribir.
+         */
+        void escribir(char c);
+
+        /**
+         * @brief Pasa al flujo todo lo acumulado.
+         */
+        void vaciar();
+
+    private:
+        std::ostream &m_salida;                 ///< Flujo de salida.
+        char m_buffer[TAM_BUFFER_ESCRITOR];     ///< Texto pendiente de escribir.
+        size_t m_usados;                        ///< Bytes ocupados en el buffer.
+};
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef __HASH_POLICY_HPP__
+#define __HASH_POLICY_HPP__
+
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+#include <type_traits>
+#include "performance.hpp"
+
+/**
+ * @brief Política de hash genérica: djb2 sobre los bytes de la clave.
+ *
+ * Una política de hash expone dos funciones estáticas:
+ * - hash(key): valor hash completo. El mapa lo reduce con una máscara, por lo que
+ *   los bits bajos deben estar bien mezclados.
+ * - equal(a, b): igualdad entre claves.
+ *
+ * La política se elige en tiempo de compilación según el tipo de la clave.
+ *
+ * @tparam Key Tipo de la clave.
+ */
+template <typename Key, typename Enable = void>
+struct Hash_Policy {
+    static size_t hash(const Key& key)
+    {
+        size_t hash_value = 5381; ///< Valor inicial del hash (un número primo utilizado como semilla).
+
+        const uint8_t* key_bytes = reinterpret_cast<const uint8_t*>(&key);
+        for (size_t i = 0; i < sizeof(Key); ++i, g_ciclos++)
+            hash_value = ((hash_value << 5) + hash_value) + key_bytes[i]; // Fórmula djb2: hash * 33 + c
+
+        return hash_value;
+    }
+
+    static bool equal(const Key& a, const Key& b)
+    {
+        return a == b;
+    }
+};
+
+/**
+ * @brief Política de hash para claves enteras (códigos de reserva, documentos).
+ *
+ * Hashing multiplicativo de Fibonacci: una sola multiplicación por 2^64/φ. Los bits altos
+ * del producto son los mejor mezclados, así que se pliegan sobre los bajos para que la
+ * máscara de una tabla de tamaño potencia de dos los aproveche.
+ */
+template <typename Key>
+struct Hash_Policy<Key, typename std::enable_if<std::is_integral<Key>::value>::type> {
+    static size_t hash(const Key& key)
+    {
+        uint64_t h = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL;
+        g_ciclos++;
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+
+    static bool equal(const Key& a, const Key& b)
+    {
+        return a == b;
+    }
+};
+
+/**
+ * @brief Política de hash para cadenas de C (FNV-1a). Compara por contenido, no por puntero.
+ */
+template <>
+struct Hash_Policy<const char*> {
+    static size_t hash(const char* key)
+    {
+        uint64_t h = 0xCBF29CE484222325ULL; ///< Base de desplazamiento de FNV-1a de 64 bits.
+        for (const unsigned char *c = reinterpret_cast<const unsigned char*>(key); *c != '\0'; ++c, g_ciclos++) {
+            h ^= *c;
+            h *= 0x100000001B3ULL; ///< Primo de FNV de 64 bits.
+        }
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+
+    static bool equal(const char* a, const char* b)
+    {
+        g_strcmp_cnt++;
+        return std::strcmp(a, b) == 0;
+    }
+};
+
+template <>
+struct Hash_Policy<char*> : Hash_Policy<const char*> {};
+
+#endif
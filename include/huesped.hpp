@@ -2,7 +2,7 @@
 #define __HUESPED_HPP__
 #include <stdint.h>
 #include <string>
-#include "linked_list.hpp"
+#include "intrusive_list.hpp"
 #include "reserva.hpp"
 /**
  * @class Huesped
@@ -99,7 +99,7 @@ class Huesped
          */
         void mostrar_reserva_huesped(Reserva *reserva);
 
-        bool tengo_reservas(Fecha *fecha_inicio, Fecha *fecha_fin);
+        bool tengo_reservas(const Fecha &fecha_inicio, const Fecha &fecha_fin);
         /**
          * @brief Destructor de la clase Huesped.
          * 
@@ -113,7 +113,7 @@ class Huesped
         char * m_nombre;           ///< Nombre del huesped.
         uint16_t m_antiguedad;     ///< Antigüedad del huesped en meses.
         float m_puntuacion;        ///< Puntuación del usuario.
-        Linked_List<Reserva*> *m_reservas; ///< Lista de reservas del huesped.
+        Intrusive_List<Reserva> m_reservas; ///< Lista de reservas del huesped, enlazadas por la propia reserva.
 };
 
 #endif
@@ -0,0 +1,106 @@
+#ifndef __INDICE_MUNICIPIOS_HPP__
+#define __INDICE_MUNICIPIOS_HPP__
+#include <cstddef>
+#include <string>
+#include "alojamiento.hpp"
+#include "arena_cadenas.hpp"
+#include "owning_unordered_map.hpp"
+#include "small_vector.hpp"
+
+#define ALOJAMIENTOS_MUNICIPIO 16 // Alojamientos de un municipio que caben en su grupo sin pedir memoria
+
+typedef Small_Vector<Alojamiento*, ALOJAMIENTOS_MUNICIPIO> Grupo_Municipio; ///< Alojamientos de un mismo municipio.
+
+/**
+ * @class Indice_Municipios
+ * @brief Índice invertido del municipio normalizado a los alojamientos que están en él.
+ *
+ * Se arma una vez al cargar los alojamientos con anexar() y ordenar(). Cada municipio tiene su grupo contiguo de
+ * alojamientos, así una búsqueda solo mira los del municipio pedido en vez de recorrer el
+ * catálogo completo y comparar cadenas en cada alojamiento.
+ *
+ * Cada grupo se mantiene ordenado por precio por noche (los empates en orden de llegada), así el
+ * filtro de precio máximo es un corte por búsqueda binaria y la disponibilidad solo se revisa en
+ * los alojamientos que entran en el presupuesto.
+ *
+ * La clave se normaliza (sin espacios en los extremos y con las letras ASCII en minúscula) tanto
+ * al indexar como al buscar, así que "  medellín" encuentra los alojamientos de "Medellín".
+ */
+class Indice_Municipios
+{
+    public:
+        Indice_Municipios(const Indice_Municipios&) = delete; ///< Elimina el constructor de copia.
+        Indice_Municipios& operator=(const Indice_Municipios&) = delete; ///< Elimina el operador de asignación.
+
+        /**
+         * @brief Constructor.
+         * @param size Número de municipios que se espera indexar.
+         */
+        Indice_Municipios(size_t size);
+
+        /**
+         * @brief Agrega un alojamiento al grupo de su municipio, en su lugar según el precio.
+         * Corre los más caros un lugar, así que es para altas sueltas después de la carga.
+         * @param alojamiento Alojamiento a indexar.
+         */
+        void agregar(Alojamiento *alojamiento);
+
+        /**
+         * @brief Agrega un alojamiento al final del grupo de su municipio, sin ordenarlo.
+         * Para la carga inicial: hay que llamar a ordenar() antes de la primera búsqueda.
+         * @param alojamiento Alojamiento a indexar.
+         */
+        void anexar(Alojamiento *alojamiento);
+
+        /**
+         * @brief Ordena cada grupo por precio una sola vez después de los anexar().
+         * Los empates quedan en el orden en que se anexaron.
+         */
+        void ordenar();
+
+        /**
+         * @brief Busca los alojamientos de un municipio.
+         * @param municipio Municipio tal como lo escribió el usuario.
+         * @return Grupo del municipio, o nullptr si no hay alojamientos en él.
+         */
+        const Grupo_Municipio *buscar(const std::string &municipio) const;
+
+        /**
+         * @brief Cuenta los alojamientos de un grupo que cuestan a lo sumo un precio por noche.
+         * Como el grupo está ordenado por precio, son los primeros de él.
+         * @param grupo Grupo de un municipio.
+         * @param precio Precio máximo por noche, o 0 para no filtrar.
+         * @return Número de alojamientos desde el inicio del grupo que cumplen.
+         */
+        static uint32_t hasta_precio(const Grupo_Municipio &grupo, float precio);
+
+        /**
+         * @brief Obtiene el número de municipios indexados.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Obtiene los bytes que ocupa el índice, sin contar los alojamientos.
+         */
+        size_t get_bytes() const;
+
+    private:
+        Owning_Unordered_Map<const char*, Grupo_Municipio> m_grupos; ///< Grupo de cada municipio normalizado.
+        Arena_Cadenas m_claves;                                       ///< Claves normalizadas del mapa.
+
+        /**
+         * @brief Normaliza el nombre de un municipio para usarlo como clave.
+         * @param texto Nombre del municipio.
+         * @param longitud Longitud del nombre.
+         * @return Nombre sin espacios en los extremos y con las letras ASCII en minúscula.
+         */
+        static std::string normalizar(const char *texto, size_t longitud);
+
+        /**
+         * @brief Busca el grupo del municipio de un alojamiento y lo crea si no existe.
+         * @return Grupo del municipio, o nullptr si el alojamiento no tiene municipio.
+         */
+        Grupo_Municipio *grupo_de(const Alojamiento *alojamiento);
+};
+
+#endif
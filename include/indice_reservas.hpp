@@ -0,0 +1,103 @@
+#ifndef __INDICE_RESERVAS_HPP__
+#define __INDICE_RESERVAS_HPP__
+#include <stdint.h>
+#include <cstddef>
+#include "fecha.hpp"
+#include "reserva.hpp"
+#include "intrusive_list.hpp"
+#include "performance.hpp"
+
+/**
+ * @class Indice_Reservas
+ * @brief Reservas de un alojamiento ordenadas por fecha de entrada, con la salida máxima de cada prefijo.
+ *
+ * Las reservas que se cruzan con [desde, hasta) son las de entrada < hasta (un prefijo del
+ * arreglo) y salida > desde. Como la salida máxima del prefijo nunca baja, la primera reserva
+ * que puede cruzarse también se halla por búsqueda binaria, así que una consulta solo recorre
+ * las reservas cercanas al rango y no todo el historial.
+ *
+ * El índice no se actualiza con cada cambio: el alojamiento lo invalida y lo reconstruye en la
+ * siguiente consulta.
+ */
+class Indice_Reservas
+{
+    public:
+        Indice_Reservas(const Indice_Reservas&) = delete; ///< Elimina el constructor de copia.
+        Indice_Reservas& operator=(const Indice_Reservas&) = delete; ///< Elimina el operador de asignación.
+
+        /**
+         * @brief Constructor. El índice empieza vacío e inválido.
+         */
+        Indice_Reservas();
+
+        /**
+         * @brief Destructor.
+         */
+        ~Indice_Reservas();
+
+        /**
+         * @brief Indica si el índice refleja la lista de reservas actual.
+         */
+        bool vigente() const;
+
+        /**
+         * @brief Marca el índice como desactualizado.
+         */
+        void invalidar();
+
+        /**
+         * @brief Vuelve a ordenar las reservas de una lista y calcula las salidas máximas.
+         * @param reservas Lista de reservas del alojamiento.
+         */
+        void reconstruir(const Intrusive_List<Reserva> &reservas);
+
+        /**
+         * @brief Recorre, en orden de entrada, las reservas que se cruzan con [desde, hasta).
+         * @param desde Fecha de inicio.
+         * @param hasta Fecha de fin (excluida).
+         * @param funcion Función que recibe un const Reserva& por cada reserva que se cruza.
+         */
+        template <typename Funcion>
+        void for_each_cruce(const Fecha &desde, const Fecha &hasta, Funcion funcion) const;
+
+        /**
+         * @brief Obtiene los bytes reservados por el índice.
+         */
+        size_t get_bytes() const;
+
+    private:
+        /**
+         * @brief Una reserva del índice con su intervalo en días seriales.
+         */
+        struct Intervalo {
+            int32_t entrada;          ///< Día serial de entrada.
+            int32_t salida;           ///< Día serial de salida.
+            int32_t max_salida;       ///< Salida máxima de las reservas hasta esta, inclusive.
+            const Reserva *reserva;   ///< Reserva indexada.
+        };
+
+        Intervalo *m_intervalos;  ///< Reservas ordenadas por entrada.
+        uint32_t m_size;          ///< Reservas indexadas.
+        uint32_t m_capacidad;     ///< Reservas que caben sin crecer.
+        bool m_vigente;           ///< Indica si el índice coincide con la lista.
+
+        /**
+         * @brief Busca el rango [inicio, fin) de posiciones que pueden cruzarse con [desde, hasta).
+         */
+        void buscar(int32_t desde, int32_t hasta, uint32_t &inicio, uint32_t &fin) const;
+};
+
+template <typename Funcion>
+void Indice_Reservas::for_each_cruce(const Fecha &desde, const Fecha &hasta, Funcion funcion) const
+{
+    const int32_t dia_desde = desde.get_dia_serial();
+    uint32_t inicio, fin;
+
+    buscar(dia_desde, hasta.get_dia_serial(), inicio, fin);
+    for (uint32_t i = inicio; i < fin; ++i, g_ciclos++) {
+        if (m_intervalos[i].salida > dia_desde)
+            funcion(*m_intervalos[i].reserva);
+    }
+}
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef INTRUSIVE_LIST_HPP
+#define INTRUSIVE_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <stdint.h>
+
+template <typename T>
+class Intrusive_List;
+
+/**
+ * @brief Enlace que un objeto lleva dentro para pertenecer a una Intrusive_List.
+ *
+ * Guarda sus vecinos y la lista en la que está, así que el objeto puede salir de la lista en O(1)
+ * sin recorrerla. Un objeto puede estar en tantas listas como enlaces tenga.
+ *
+ * @tparam T Tipo del objeto que contiene el enlace.
+ */
+template <typename T>
+class Intrusive_Hook {
+public:
+    T* anterior;              ///< Objeto anterior en la lista.
+    T* siguiente;             ///< Objeto siguiente en la lista.
+    Intrusive_List<T>* lista; ///< Lista a la que pertenece, o nullptr si está suelto.
+
+    /**
+     * @brief Constructor. El enlace empieza suelto.
+     */
+    Intrusive_Hook();
+
+    Intrusive_Hook(const Intrusive_Hook&) = delete; ///< Un enlace no se copia junto con su objeto.
+    Intrusive_Hook& operator=(const Intrusive_Hook&) = delete; ///< Elimina el operador de asignación.
+
+    /**
+     * @brief Saca al objeto de la lista en la que esté, si está en alguna.
+     * @param dueno Objeto que contiene este enlace.
+     */
+    void desenlazar(T* dueno);
+};
+
+/**
+ * @brief Lista doblemente enlazada intrusiva.
+ *
+ * No reserva nodos: enlaza los objetos a través de un Intrusive_Hook que ellos mismos contienen,
+ * indicado con un puntero a miembro. Insertar y eliminar son O(1). La lista no es dueña de los
+ * objetos; al destruirse solo suelta sus enlaces.
+ *
+ * @tparam T Tipo de los objetos enlazados.
+ */
+template <typename T>
+class Intrusive_List {
+private:
+    Intrusive_Hook<T> T::* m_enlace; ///< Enlace de los objetos que usa esta lista.
+    T* m_cabeza;                     ///< Primer objeto de la lista.
+    uint32_t m_size;                 ///< Número de objetos enlazados.
+
+public:
+    Intrusive_List(const Intrusive_List&) = delete; ///< Elimina el constructor de copia.
+    Intrusive_List& operator=(const Intrusive_List&) = delete; ///< Elimina el operador de asignación.
+
+    /**
+     * @brief Constructor.
+     * @param enlace Miembro de T que se usa como enlace de esta lista.
+     */
+    Intrusive_List(Intrusive_Hook<T> T::* enlace);
+
+    /**
+     * @brief Destructor. Suelta los enlaces de los objetos, pero no los destruye.
+     */
+    ~Intrusive_List();
+
+    /**
+     * @brief Enlaza un objeto al frente de la lista. Si ya estaba en otra lista, primero sale de ella.
+     * @param elemento Objeto a enlazar.
+     */
+    void insert_front(T* elemento);
+
+    /**
+     * @brief Saca un objeto de la lista en O(1).
+     * @param elemento Objeto a sacar.
+     * @return true si el objeto estaba en esta lista.
+     */
+    bool remove(T* elemento);
+
+    /**
+     * @brief Indica si un objeto está enlazado en esta lista.
+     * @param elemento Objeto a consultar.
+     */
+    bool contains(const T* elemento) const;
+
+    /**
+     * @brief Suelta todos los objetos de la lista.
+     */
+    void clear();
+
+    /**
+     * @brief Obtiene el primer objeto de la lista.
+     * @return Puntero al primer objeto, o nullptr si está vacía.
+     */
+    T* get_head() const;
+
+    /**
+     * @brief Obtiene el objeto que sigue a otro en la lista.
+     * @param elemento Objeto actual.
+     * @return Puntero al siguiente objeto, o nullptr si es el último.
+     */
+    T* get_next(const T* elemento) const;
+
+    /**
+     * @brief Obtiene el número de objetos enlazados.
+     */
+    uint32_t get_size() const;
+
+    /**
+     * @brief Verifica si la lista está vacía.
+     */
+    bool is_empty() const;
+
+    class const_iterator;
+
+    /**
+     * @brief Iterador hacia adelante sobre los objetos enlazados, compatible con los algoritmos de la STL.
+     * Recorre los objetos, no punteros a ellos: for (T& objeto : lista).
+     */
+    class iterator {
+        public:
+            typedef std::forward_iterator_tag iterator_category; ///< Solo avanza.
+            typedef T value_type;                                ///< Objeto enlazado.
+            typedef std::ptrdiff_t difference_type;              ///< Distancia entre iteradores.
+            typedef T* pointer;                                  ///< Puntero al objeto.
+            typedef T& reference;                                ///< Referencia al objeto.
+
+            /**
+             * @brief Construye un iterador sobre un objeto (nullptr marca el final).
+             * @param actual Objeto actual.
+             * @param enlace Enlace que sigue la lista.
+             */
+            iterator(T* actual = nullptr, Intrusive_Hook<T> T::* enlace = nullptr);
+
+            T& operator*() const;                        ///< Objeto actual.
+            T* operator->() const;                       ///< Acceso al objeto actual.
+            iterator& operator++();                      ///< Avanza al siguiente objeto.
+            iterator operator++(int);                    ///< Avanza y devuelve la posición anterior.
+            bool operator==(const iterator &otro) const; ///< Compara posiciones.
+            bool operator!=(const iterator &otro) const; ///< Compara posiciones.
+
+        private:
+            T* m_actual;                      ///< Objeto actual.
+            Intrusive_Hook<T> T::* m_enlace;  ///< Enlace que sigue la lista.
+
+            friend class const_iterator;
+    };
+
+    /**
+     * @brief Iterador hacia adelante de solo lectura sobre los objetos enlazados.
+     */
+    class const_iterator {
+        public:
+            typedef std::forward_iterator_tag iterator_category; ///< Solo avanza.
+            typedef T value_type;                                ///< Objeto enlazado.
+            typedef std::ptrdiff_t difference_type;              ///< Distancia entre iteradores.
+            typedef const T* pointer;                            ///< Puntero al objeto.
+            typedef const T& reference;                          ///< Referencia al objeto.
+
+            /**
+             * @brief Construye un iterador sobre un objeto (nullptr marca el final).
+             * @param actual Objeto actual.
+             * @param enlace Enlace que sigue la lista.
+             */
+            const_iterator(const T* actual = nullptr, Intrusive_Hook<T> T::* enlace = nullptr);
+
+            /**
+             * @brief Convierte un iterador en uno de solo lectura.
+             * @param otro Iterador a convertir.
+             */
+            const_iterator(const iterator &otro);
+
+            const T& operator*() const;                        ///< Objeto actual.
+            const T* operator->() const;                       ///< Acceso al objeto actual.
+            const_iterator& operator++();                      ///< Avanza al siguiente objeto.
+            const_iterator operator++(int);                    ///< Avanza y devuelve la posición anterior.
+            bool operator==(const const_iterator &otro) const; ///< Compara posiciones.
+            bool operator!=(const const_iterator &otro) const; ///< Compara posiciones.
+
+        private:
+            const T* m_actual;                ///< Objeto actual.
+            Intrusive_Hook<T> T::* m_enlace;  ///< Enlace que sigue la lista.
+    };
+
+    iterator begin();              ///< Iterador al primer objeto.
+    iterator end();                ///< Iterador que marca el final.
+    const_iterator begin() const;  ///< Iterador de solo lectura al primer objeto.
+    const_iterator end() const;    ///< Iterador de solo lectura que marca el final.
+    const_iterator cbegin() const; ///< Iterador de solo lectura al primer objeto.
+    const_iterator cend() const;   ///< Iterador de solo lectura que marca el final.
+};
+
+#include "intrusive_list.tpp"
+#endif
@@ -0,0 +1,225 @@
+/**
+ * @file intrusive_list.tpp
+ * @brief Implementación de las clases Intrusive_Hook e Intrusive_List.
+ */
+#ifndef __INTRUSIVE_LIST_TPP__
+#define __INTRUSIVE_LIST_TPP__
+#include "intrusive_list.hpp"
+#include "performance.hpp"
+
+template <typename T>
+Intrusive_Hook<T>::Intrusive_Hook() : anterior(nullptr), siguiente(nullptr), lista(nullptr) {}
+
+template <typename T>
+void Intrusive_Hook<T>::desenlazar(T* dueno) {
+    if (lista != nullptr)
+        lista->remove(dueno);
+}
+
+template <typename T>
+Intrusive_List<T>::Intrusive_List(Intrusive_Hook<T> T::* enlace)
+    : m_enlace(enlace), m_cabeza(nullptr), m_size(0) {}
+
+template <typename T>
+Intrusive_List<T>::~Intrusive_List() {
+    clear();
+}
+
+template <typename T>
+void Intrusive_List<T>::insert_front(T* elemento) {
+    Intrusive_Hook<T>& enlace = elemento->*m_enlace;
+    if (enlace.lista != nullptr)
+        enlace.lista->remove(elemento);
+
+    enlace.anterior = nullptr;
+    enlace.siguiente = m_cabeza;
+    enlace.lista = this;
+    if (m_cabeza != nullptr)
+        (m_cabeza->*m_enlace).anterior = elemento;
+
+    m_cabeza = elemento;
+    m_size++;
+}
+
+/**
+ * @brief Reenlaza los vecinos del objeto entre sí, sin recorrer la lista.
+ */
+template <typename T>
+bool Intrusive_List<T>::remove(T* elemento) {
+    if (elemento == nullptr)
+        return false;
+
+    Intrusive_Hook<T>& enlace = elemento->*m_enlace;
+    if (enlace.lista != this)
+        return false;
+
+    if (enlace.anterior != nullptr)
+        (enlace.anterior->*m_enlace).siguiente = enlace.siguiente;
+    else
+        m_cabeza = enlace.siguiente;
+
+    if (enlace.siguiente != nullptr)
+        (enlace.siguiente->*m_enlace).anterior = enlace.anterior;
+
+    enlace.anterior = nullptr;
+    enlace.siguiente = nullptr;
+    enlace.lista = nullptr;
+    m_size--;
+    return true;
+}
+
+template <typename T>
+bool Intrusive_List<T>::contains(const T* elemento) const {
+    return elemento != nullptr && (elemento->*m_enlace).lista == this;
+}
+
+/**
+ * @brief Suelta los enlaces para que los objetos no apunten a una lista que ya no existe.
+ */
+template <typename T>
+void Intrusive_List<T>::clear() {
+    T* actual = m_cabeza;
+    while (actual != nullptr) {
+        Intrusive_Hook<T>& enlace = actual->*m_enlace;
+        T* siguiente = enlace.siguiente;
+        enlace.anterior = nullptr;
+        enlace.siguiente = nullptr;
+        enlace.lista = nullptr;
+        actual = siguiente;
+        g_ciclos++;
+    }
+    m_cabeza = nullptr;
+    m_size = 0;
+}
+
+template <typename T>
+T* Intrusive_List<T>::get_head() const {
+    return m_cabeza;
+}
+
+template <typename T>
+T* Intrusive_List<T>::get_next(const T* elemento) const {
+    return (elemento->*m_enlace).siguiente;
+}
+
+template <typename T>
+uint32_t Intrusive_List<T>::get_size() const {
+    return m_size;
+}
+
+template <typename T>
+bool Intrusive_List<T>::is_empty() const {
+    return m_size == 0;
+}
+
+template <typename T>
+Intrusive_List<T>::iterator::iterator(T* actual, Intrusive_Hook<T> T::* enlace)
+    : m_actual(actual), m_enlace(enlace) {}
+
+template <typename T>
+T& Intrusive_List<T>::iterator::operator*() const {
+    return *m_actual;
+}
+
+template <typename T>
+T* Intrusive_List<T>::iterator::operator->() const {
+    return m_actual;
+}
+
+template <typename T>
+typename Intrusive_List<T>::iterator& Intrusive_List<T>::iterator::operator++() {
+    m_actual = (m_actual->*m_enlace).siguiente;
+    g_ciclos++;
+    return *this;
+}
+
+template <typename T>
+typename Intrusive_List<T>::iterator Intrusive_List<T>::iterator::operator++(int) {
+    iterator anterior = *this;
+    ++(*this);
+    return anterior;
+}
+
+template <typename T>
+bool Intrusive_List<T>::iterator::operator==(const iterator &otro) const {
+    return m_actual == otro.m_actual;
+}
+
+template <typename T>
+bool Intrusive_List<T>::iterator::operator!=(const iterator &otro) const {
+    return !(*this == otro);
+}
+
+template <typename T>
+Intrusive_List<T>::const_iterator::const_iterator(const T* actual, Intrusive_Hook<T> T::* enlace)
+    : m_actual(actual), m_enlace(enlace) {}
+
+template <typename T>
+Intrusive_List<T>::const_iterator::const_iterator(const iterator &otro)
+    : m_actual(otro.m_actual), m_enlace(otro.m_enlace) {}
+
+template <typename T>
+const T& Intrusive_List<T>::const_iterator::operator*() const {
+    return *m_actual;
+}
+
+template <typename T>
+const T* Intrusive_List<T>::const_iterator::operator->() const {
+    return m_actual;
+}
+
+template <typename T>
+typename Intrusive_List<T>::const_iterator& Intrusive_List<T>::const_iterator::operator++() {
+    m_actual = (m_actual->*m_enlace).siguiente;
+    g_ciclos++;
+    return *this;
+}
+
+template <typename T>
+typename Intrusive_List<T>::const_iterator Intrusive_List<T>::const_iterator::operator++(int) {
+    const_iterator anterior = *this;
+    ++(*this);
+    return anterior;
+}
+
+template <typename T>
+bool Intrusive_List<T>::const_iterator::operator==(const const_iterator &otro) const {
+    return m_actual == otro.m_actual;
+}
+
+template <typename T>
+bool Intrusive_List<T>::const_iterator::operator!=(const const_iterator &otro) const {
+    return !(*this == otro);
+}
+
+template <typename T>
+typename Intrusive_List<T>::iterator Intrusive_List<T>::begin() {
+    return iterator(m_cabeza, m_enlace);
+}
+
+template <typename T>
+typename Intrusive_List<T>::iterator Intrusive_List<T>::end() {
+    return iterator(nullptr, m_enlace);
+}
+
+template <typename T>
+typename Intrusive_List<T>::const_iterator Intrusive_List<T>::begin() const {
+    return const_iterator(m_cabeza, m_enlace);
+}
+
+template <typename T>
+typename Intrusive_List<T>::const_iterator Intrusive_List<T>::end() const {
+    return const_iterator(nullptr, m_enlace);
+}
+
+template <typename T>
+typename Intrusive_List<T>::const_iterator Intrusive_List<T>::cbegin() const {
+    return const_iterator(m_cabeza, m_enlace);
+}
+
+template <typename T>
+typename Intrusive_List<T>::const_iterator Intrusive_List<T>::cend() const {
+    return const_iterator(nullptr, m_enlace);
+}
+
+#endif
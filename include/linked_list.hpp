@@ -1,8 +1,11 @@
 #ifndef LINKED_LIST_HPP
 #define LINKED_LIST_HPP
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <stdint.h>
+#include "pool_allocator.hpp"
 /**
  * @brief Nodo de la lista enlazada.
  * 
@@ -24,14 +27,54 @@ public:
 /**
  * @brief Lista enlazada simple que almacena punteros.
  * 
+ * Los nodos se piden a un asignador propio de la lista (por defecto un Pool_Allocator),
+ * así que insertar no llama a malloc por cada nodo y destruir la lista libera sus trozos
+ * de memoria sin recorrer los nodos.
+ * 
  * @tparam T Tipo de dato almacenado (puntero).
+ * @tparam Allocator Asignador de nodos. Debe ofrecer allocate(), deallocate() y release().
  */
-template <typename T>
+template <typename T, typename Allocator = Pool_Allocator<Node<T>>>
 class Linked_List {
 private:
     uint32_t size;
     Node<T>* head;  ///< Puntero al primer nodo.
+    Allocator m_pool; ///< Asignador de los nodos de la lista.
+
+    /**
+     * @brief Construye un nodo en memoria del asignador.
+     * @param value Dato a almacenar.
+     * @return Puntero al nuevo nodo.
+     */
+    Node<T>* crear_nodo(T value);
+
+    /**
+     * @brief Destruye un nodo y devuelve su memoria al asignador.
+     * @param node Nodo a liberar.
+     */
+    void liberar_nodo(Node<T>* node);
+
+    /**
+     * @brief Corta una corrida de hasta n nodos desde el inicio dado.
+     * @param inicio Primer nodo de la corrida (puede ser nullptr).
+     * @param n Número de nodos de la corrida.
+     * @return Primer nodo después de la corrida, o nullptr si no quedan más.
+     */
+    static Node<T>* separar(Node<T>* inicio, uint32_t n);
+
+    /**
+     * @brief Mezcla dos corridas ordenadas y las enlaza detrás de cola.
+     * @param izquierda Primera corrida.
+     * @param derecha Segunda corrida.
+     * @param cola Enlace donde se cuelga el resultado.
+     * @param comparador Función de comparación (true si el primero va antes).
+     * @return Enlace next del último nodo mezclado.
+     */
+    static Node<T>** mezclar(Node<T>* izquierda, Node<T>* derecha, Node<T>** cola, bool (*comparador)(T, T));
 public:
+    Linked_List(const Linked_List&) = delete; ///< Elimina el constructor de copia.
+    Linked_List& operator=(const Linked_List&) = delete; ///< Elimina el operador de asignación.
+
     /**
      * @brief Constructor por defecto.
      */
@@ -39,6 +82,7 @@ public:
 
     /**
      * @brief Destructor. Elimina los nodos, pero no los datos apuntados.
+     * Si los nodos se destruyen trivialmente, se liberan los trozos del asignador sin recorrer la lista.
      */
     ~Linked_List();
 
@@ -81,9 +125,13 @@ public:
     Node<T>* get_next(Node<T>* node) const;
 
     /**
-     * @brief Ordena la lista usando el algoritmo merge sort.
+     * @brief Ordena la lista usando el algoritmo merge sort de abajo hacia arriba.
+     * Es estable, O(n log n) y no reserva memoria: solo reenlaza los nodos.
+     * Para construir una lista ordenada con muchos elementos conviene insertar con insert_front()
+     * y ordenar una sola vez, en lugar de usar insert_sorted(), que es O(n) por inserción.
+     * @param comparador Función de comparación (true si el primero va antes).
      */
-    void sort();
+    void sort(bool (*comparador)(T, T));
 
     /**
      * @brief muestra el tamaño de la lista
@@ -97,6 +145,79 @@ public:
      * @param comparador Función de comparación para determinar el orden.
      */
     void insert_sorted(T nuevo_elemento, bool (*comparador)(T, T));
+
+    class const_iterator;
+
+    /**
+     * @brief Iterador hacia adelante sobre los datos de la lista, compatible con los algoritmos de la STL.
+     */
+    class iterator {
+        public:
+            typedef std::forward_iterator_tag iterator_category; ///< Solo avanza.
+            typedef T value_type;                                ///< Dato almacenado.
+            typedef std::ptrdiff_t difference_type;              ///< Distancia entre iteradores.
+            typedef T* pointer;                                  ///< Puntero al dato.
+            typedef T& reference;                                ///< Referencia al dato.
+
+            /**
+             * @brief Construye un iterador sobre un nodo (nullptr marca el final).
+             * @param actual Nodo actual.
+             */
+            iterator(Node<T>* actual = nullptr);
+
+            T& operator*() const;                        ///< Dato del nodo actual.
+            T* operator->() const;                       ///< Acceso al dato del nodo actual.
+            iterator& operator++();                      ///< Avanza al siguiente nodo.
+            iterator operator++(int);                    ///< Avanza y devuelve la posición anterior.
+            bool operator==(const iterator &otro) const; ///< Compara posiciones.
+            bool operator!=(const iterator &otro) const; ///< Compara posiciones.
+
+        private:
+            Node<T>* m_actual; ///< Nodo actual.
+
+            friend class const_iterator;
+    };
+
+    /**
+     * @brief Iterador hacia adelante de solo lectura sobre los datos de la lista.
+     */
+    class const_iterator {
+        public:
+            typedef std::forward_iterator_tag iterator_category; ///< Solo avanza.
+            typedef T value_type;                                ///< Dato almacenado.
+            typedef std::ptrdiff_t difference_type;              ///< Distancia entre iteradores.
+            typedef const T* pointer;                            ///< Puntero al dato.
+            typedef const T& reference;                          ///< Referencia al dato.
+
+            /**
+             * @brief Construye un iterador sobre un nodo (nullptr marca el final).
+             * @param actual Nodo actual.
+             */
+            const_iterator(const Node<T>* actual = nullptr);
+
+            /**
+             * @brief Convierte un iterador en uno de solo lectura.
+             * @param otro Iterador a convertir.
+             */
+            const_iterator(const iterator &otro);
+
+            const T& operator*() const;                        ///< Dato del nodo actual.
+            const T* operator->() const;                       ///< Acceso al dato del nodo actual.
+            const_iterator& operator++();                      ///< Avanza al siguiente nodo.
+            const_iterator operator++(int);                    ///< Avanza y devuelve la posición anterior.
+            bool operator==(const const_iterator &otro) const; ///< Compara posiciones.
+            bool operator!=(const const_iterator &otro) const; ///< Compara posiciones.
+
+        private:
+            const Node<T>* m_actual; ///< Nodo actual.
+    };
+
+    iterator begin();              ///< Iterador al primer dato.
+    iterator end();                ///< Iterador que marca el final.
+    const_iterator begin() const;  ///< Iterador de solo lectura al primer dato.
+    const_iterator end() const;    ///< Iterador de solo lectura que marca el final.
+    const_iterator cbegin() const; ///< Iterador de solo lectura al primer dato.
+    const_iterator cend() const;   ///< Iterador de solo lectura que marca el final.
 };
 
 #include "linked_list.tpp"
@@ -5,38 +5,60 @@
 #ifndef __LINKED_LIST_TPP__
 #define __LINKED_LIST_TPP__
 #include "linked_list.hpp"
+#include <new>
+#include <type_traits>
 #include "performance.hpp"
 
 template <typename T>
 Node<T>::Node(T value) : data(value), next(nullptr) {}
 
-template <typename T>
-Linked_List<T>::Linked_List() : head(nullptr), size(0) {}
+template <typename T, typename Allocator>
+Linked_List<T, Allocator>::Linked_List() : head(nullptr), size(0) {}
 
 /**
  * @brief Destructor de la lista enlazada.
  * Elimina todos los nodos, pero no los datos apuntados por ellos.
+ * La memoria de los nodos la libera el asignador por trozos completos.
  */
-template <typename T>
-Linked_List<T>::~Linked_List() {
-    Node<T>* current = head;
-    while (current) {
-        Node<T>* next = current->next;
-        g_ciclos++;
-        g_tamano -= sizeof(Node<T>);
-        delete current;  // Solo elimina los nodos, no los datos apuntados
-        current = next;
+template <typename T, typename Allocator>
+Linked_List<T, Allocator>::~Linked_List() {
+    if constexpr (!std::is_trivially_destructible<Node<T>>::value) {
+        Node<T>* current = head;
+        while (current) {
+            Node<T>* next = current->next;
+            g_ciclos++;
+            current->~Node<T>();  // Solo destruye los nodos, no los datos apuntados
+            current = next;
+        }
     }
+    head = nullptr;
+    m_pool.release();
+}
+
+/**
+ * @brief Construye un nodo en un bloque del asignador.
+ */
+template <typename T, typename Allocator>
+Node<T>* Linked_List<T, Allocator>::crear_nodo(T value) {
+    return new (m_pool.allocate()) Node<T>(value);
+}
+
+/**
+ * @brief Destruye un nodo y devuelve su bloque al asignador.
+ */
+template <typename T, typename Allocator>
+void Linked_List<T, Allocator>::liberar_nodo(Node<T>* node) {
+    node->~Node<T>();
+    m_pool.deallocate(node);
 }
 
 /**
  * @brief Inserta un nuevo nodo al frente de la lista.
  * @param value Dato a insertar.
  */
-template <typename T>
-void Linked_List<T>::insert_front(T value) {
-    Node<T>* new_node = new Node<T>(value);
-    g_tamano += sizeof(Node<T>);
+template <typename T, typename Allocator>
+void Linked_List<T, Allocator>::insert_front(T value) {
+    Node<T>* new_node = crear_nodo(value);
     new_node->next = head;
     head = new_node;
     size++;
@@ -46,8 +68,8 @@ void Linked_List<T>::insert_front(T value) {
  * @brief Remueve el primer nodo que contiene el dato especificado.
  * @param value Dato a eliminar (comparación por puntero).
  */
-template <typename T>
-bool Linked_List<T>::remove(T value) {
+template <typename T, typename Allocator>
+bool Linked_List<T, Allocator>::remove(T value) {
     /**
      * @brief Elimina el primer nodo que contiene el dato especificado.
      * @param value Dato a eliminar (comparación por puntero).
@@ -58,8 +80,7 @@ bool Linked_List<T>::remove(T value) {
     if (head->data == value) {
         Node<T>* temp = head;
         head = head->next;
-        g_tamano -= sizeof(Node<T>);
-        delete temp;
+        liberar_nodo(temp);
         size--;
         return true;
     }
@@ -74,8 +95,7 @@ bool Linked_List<T>::remove(T value) {
         Node<T>* temp = current->next;
         current->next = current->next->next;
         size--;
-        g_tamano -= sizeof(Node<T>);
-        delete temp;
+        liberar_nodo(temp);
         return true;
     }
     return false;  // No se encontró el valor
@@ -84,8 +104,8 @@ bool Linked_List<T>::remove(T value) {
 /**
  * @brief Verifica si la lista está vacía.
  */
-template <typename T>
-bool Linked_List<T>::is_empty() const {
+template <typename T, typename Allocator>
+bool Linked_List<T, Allocator>::is_empty() const {
     return head == nullptr;
 }
 
@@ -94,8 +114,8 @@ bool Linked_List<T>::is_empty() const {
  * 
  * @warning Solo debe usarse si T es un puntero.
  */
-template <typename T>
-void Linked_List<T>::clear_data() {
+template <typename T, typename Allocator>
+void Linked_List<T, Allocator>::clear_data() {
     Node<T>* current = head;
     while (current) {
         // Elimina el objeto apuntado por data
@@ -109,8 +129,8 @@ void Linked_List<T>::clear_data() {
 /**
  * @brief retorna el primer nodo de la lista.
  */
-template <typename T>
-Node<T>* Linked_List<T>::get_head() const {
+template <typename T, typename Allocator>
+Node<T>* Linked_List<T, Allocator>::get_head() const {
     return head;
 }
 
@@ -119,30 +139,95 @@ Node<T>* Linked_List<T>::get_head() const {
  * @param node Nodo actual.
  * @return Puntero al siguiente nodo, o nullptr si no hay más.
  */
-template <typename T>
-Node<T>* Linked_List<T>::get_next(Node<T>* node) const {
+template <typename T, typename Allocator>
+Node<T>* Linked_List<T, Allocator>::get_next(Node<T>* node) const {
     return node ? node->next : nullptr;
 }
 
 /**
  * @brief Obtiene el tamaño de la lista.
  */
-template <typename T>
-uint32_t Linked_List<T>::get_size() const {
+template <typename T, typename Allocator>
+uint32_t Linked_List<T, Allocator>::get_size() const {
     return size;
 }
 
+/**
+ * @brief Corta una corrida de hasta n nodos y devuelve el resto de la lista.
+ */
+template <typename T, typename Allocator>
+Node<T>* Linked_List<T, Allocator>::separar(Node<T>* inicio, uint32_t n) {
+    for (uint32_t i = 1; inicio != nullptr && i < n; ++i, g_ciclos++)
+        inicio = inicio->next;
+
+    if (inicio == nullptr)
+        return nullptr;
+
+    Node<T>* resto = inicio->next;
+    inicio->next = nullptr;
+    return resto;
+}
+
+/**
+ * @brief Mezcla dos corridas ordenadas. Ante empate toma de la izquierda, por eso el ordenamiento es estable.
+ */
+template <typename T, typename Allocator>
+Node<T>** Linked_List<T, Allocator>::mezclar(Node<T>* izquierda, Node<T>* derecha, Node<T>** cola,
+                                             bool (*comparador)(T, T)) {
+    while (izquierda != nullptr && derecha != nullptr) {
+        if (comparador(derecha->data, izquierda->data)) {
+            *cola = derecha;
+            derecha = derecha->next;
+        } else {
+            *cola = izquierda;
+            izquierda = izquierda->next;
+        }
+        cola = &(*cola)->next;
+        g_ciclos++;
+    }
+
+    *cola = (izquierda != nullptr) ? izquierda : derecha;
+    while (*cola != nullptr) {
+        cola = &(*cola)->next;
+        g_ciclos++;
+    }
+    return cola;
+}
+
+/**
+ * @brief Merge sort de abajo hacia arriba: en cada pasada mezcla corridas vecinas de ancho 1, 2, 4...
+ * hasta cubrir la lista. No usa recursión ni memoria adicional.
+ */
+template <typename T, typename Allocator>
+void Linked_List<T, Allocator>::sort(bool (*comparador)(T, T)) {
+    if (head == nullptr || head->next == nullptr)
+        return;
+
+    for (uint32_t ancho = 1; ancho < size; ancho *= 2) {
+        Node<T>* restante = head;
+        Node<T>* ordenada = nullptr;
+        Node<T>** cola = &ordenada;
+
+        while (restante != nullptr) {
+            Node<T>* izquierda = restante;
+            Node<T>* derecha = separar(izquierda, ancho);
+            restante = separar(derecha, ancho);
+            cola = mezclar(izquierda, derecha, cola, comparador);
+        }
+        head = ordenada;
+    }
+}
+
 /**
  * @brief Inserta un nuevo elemento en la lista de forma ordenada.
  */
-template <typename T>
-void Linked_List<T>::insert_sorted(T nuevo_elemento, bool (*comparador)(T, T)) 
+template <typename T, typename Allocator>
+void Linked_List<T, Allocator>::insert_sorted(T nuevo_elemento, bool (*comparador)(T, T)) 
 {
     /**
     * @brief Inserta un nuevo elemento en la lista de forma ordenada.
     */
-    Node<T>* nuevo = new Node<T>(nuevo_elemento);
-    g_tamano += sizeof(nuevo->data) + sizeof(nuevo->next);
+    Node<T>* nuevo = crear_nodo(nuevo_elemento);
     // Si la lista está vacía o el nuevo elemento es menor que el primero
     if (!head || comparador(nuevo_elemento, head->data)) {
         nuevo->next = head;
@@ -163,4 +248,111 @@ void Linked_List<T>::insert_sorted(T nuevo_elemento, bool (*comparador)(T, T))
     size++;
 }
 
+template <typename T, typename Allocator>
+Linked_List<T, Allocator>::iterator::iterator(Node<T>* actual) : m_actual(actual) {}
+
+template <typename T, typename Allocator>
+T& Linked_List<T, Allocator>::iterator::operator*() const {
+    return m_actual->data;
+}
+
+template <typename T, typename Allocator>
+T* Linked_List<T, Allocator>::iterator::operator->() const {
+    return &m_actual->data;
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::iterator& Linked_List<T, Allocator>::iterator::operator++() {
+    m_actual = m_actual->next;
+    g_ciclos++;
+    return *this;
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::iterator Linked_List<T, Allocator>::iterator::operator++(int) {
+    iterator anterior = *this;
+    ++(*this);
+    return anterior;
+}
+
+template <typename T, typename Allocator>
+bool Linked_List<T, Allocator>::iterator::operator==(const iterator &otro) const {
+    return m_actual == otro.m_actual;
+}
+
+template <typename T, typename Allocator>
+bool Linked_List<T, Allocator>::iterator::operator!=(const iterator &otro) const {
+    return !(*this == otro);
+}
+
+template <typename T, typename Allocator>
+Linked_List<T, Allocator>::const_iterator::const_iterator(const Node<T>* actual) : m_actual(actual) {}
+
+template <typename T, typename Allocator>
+Linked_List<T, Allocator>::const_iterator::const_iterator(const iterator &otro) : m_actual(otro.m_actual) {}
+
+template <typename T, typename Allocator>
+const T& Linked_List<T, Allocator>::const_iterator::operator*() const {
+    return m_actual->data;
+}
+
+template <typename T, typename Allocator>
+const T* Linked_List<T, Allocator>::const_iterator::operator->() const {
+    return &m_actual->data;
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::const_iterator& Linked_List<T, Allocator>::const_iterator::operator++() {
+    m_actual = m_actual->next;
+    g_ciclos++;
+    return *this;
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::const_iterator Linked_List<T, Allocator>::const_iterator::operator++(int) {
+    const_iterator anterior = *this;
+    ++(*this);
+    return anterior;
+}
+
+template <typename T, typename Allocator>
+bool Linked_List<T, Allocator>::const_iterator::operator==(const const_iterator &otro) const {
+    return m_actual == otro.m_actual;
+}
+
+template <typename T, typename Allocator>
+bool Linked_List<T, Allocator>::const_iterator::operator!=(const const_iterator &otro) const {
+    return !(*this == otro);
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::iterator Linked_List<T, Allocator>::begin() {
+    return iterator(head);
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::iterator Linked_List<T, Allocator>::end() {
+    return iterator(nullptr);
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::const_iterator Linked_List<T, Allocator>::begin() const {
+    return const_iterator(head);
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::const_iterator Linked_List<T, Allocator>::end() const {
+    return const_iterator(nullptr);
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::const_iterator Linked_List<T, Allocator>::cbegin() const {
+    return const_iterator(head);
+}
+
+template <typename T, typename Allocator>
+typename Linked_List<T, Allocator>::const_iterator Linked_List<T, Allocator>::cend() const {
+    return const_iterator(nullptr);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,159 @@
+#ifndef __OWNING_UNORDERED_MAP_HPP__
+#define __OWNING_UNORDERED_MAP_HPP__
+
+#include <cstddef>
+#include <ostream>
+#include <stdint.h>
+#include "unordered_map.hpp"
+#include "pool_allocator.hpp"
+
+/**
+ * @brief Mapa no ordenado dueño de sus valores.
+ *
+ * Los valores se construyen en su lugar (emplace) dentro de bloques de un Pool_Allocator propio
+ * del mapa, en vez de un new por registro, y el mapa los destruye al borrarlos o al destruirse.
+ * Los bloques del pool no se mueven cuando el mapa crece o se reorganiza, así que los punteros
+ * devueltos por emplace() y find() son estables hasta que se borra la clave.
+ *
+ * La búsqueda, el recorrido y las estadísticas son las del Unordered_Map interno, que guarda los
+ * punteros a los bloques.
+ *
+ * @tparam Key Tipo de la clave.
+ * @tparam Value Tipo del valor, construido y destruido por el mapa.
+ * @tparam Hash Política de hash e igualdad de las claves.
+ */
+template <typename Key, typename Value, typename Hash = Hash_Policy<Key>>
+class Owning_Unordered_Map {
+    private:
+        Unordered_Map<Key, Value, Hash> m_mapa; ///< Índice de las claves a los valores del pool.
+        Pool_Allocator<Value> m_pool;          ///< Memoria de los valores.
+
+    public:
+        typedef typename Unordered_Map<Key, Value, Hash>::iterator iterator; ///< Iterador sobre las entradas.
+        typedef typename Unordered_Map<Key, Value, Hash>::const_iterator const_iterator; ///< Iterador de solo lectura.
+
+        Owning_Unordered_Map(const Owning_Unordered_Map&) = delete; ///< Elimina el constructor de copia.
+        Owning_Unordered_Map& operator=(const Owning_Unordered_Map&) = delete; ///< Elimina el operador de asignación.
+
+        /**
+         * @brief Constructor.
+         * @param size Número de elementos que se espera almacenar.
+         */
+        Owning_Unordered_Map(size_t size);
+
+        /**
+         * @brief Destructor. Destruye todos los valores y libera su memoria.
+         */
+        ~Owning_Unordered_Map();
+
+        /**
+         * @brief Construye un valor en su lugar y lo asocia a la clave.
+         * Si la clave ya existe, el valor anterior se destruye y el nuevo ocupa el mismo bloque.
+         *
+         * @param key Clave del valor.
+         * @param args Argumentos del constructor de Value.
+         * @return Puntero estable al valor construido.
+         */
+        template <typename... Args>
+        Value *emplace(const Key& key, Args&&... args);
+
+        /**
+         * @brief Busca el valor asociado a una clave.
+         *
+         * @param key La clave a buscar.
+         * @return Puntero al valor, o nullptr si no se encuentra.
+         */
+        Value *find(const Key& key);
+
+        /**
+         * @brief Busca el valor asociado a una clave sin modificar el mapa.
+         *
+         * @param key La clave a buscar.
+         * @return Puntero al valor, o nullptr si no se encuentra.
+         */
+        Value *find(const Key& key) const;
+
+        /**
+         * @brief Busca un lote de claves (ver Unordered_Map::find_many).
+         *
+         * @param keys Claves a buscar.
+         * @param n Número de claves.
+         * @param out Arreglo de n posiciones donde se deja el valor de cada clave (nullptr si no está).
+         */
+        void find_many(const Key* keys, size_t n, Value** out);
+
+        /**
+         * @brief Elimina una clave y destruye su valor.
+         *
+         * @param key Clave del elemento que se desea eliminar.
+         * @return true si la clave existía.
+         */
+        bool erase(const Key& key);
+
+        /**
+         * @brief Garantiza capacidad para al menos n elementos.
+         *
+         * @param n Número de elementos que se espera almacenar.
+         */
+        void reserve(size_t n);
+
+        /**
+         * @brief Devuelve el número de elementos almacenados.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Devuelve el tamaño en memoria del mapa, incluida la memoria reservada para los valores.
+         */
+        size_t info_map() const;
+
+        /**
+         * @brief Destruye todos los valores y deja el mapa vacío.
+         */
+        void clear_values();
+
+        /**
+         * @brief Aplica una función a cada par clave-valor (ver Unordered_Map::for_each).
+         *
+         * @param funcion Función que recibe (clave, valor). Si devuelve bool, false detiene el recorrido.
+         * @return true si se recorrió todo el mapa.
+         */
+        template <typename F>
+        bool for_each(F&& funcion);
+
+        /**
+         * @brief Estadísticas del índice (ver Unordered_Map::estadisticas).
+         */
+        Estadisticas_Mapa estadisticas() const;
+
+        /**
+         * @brief Imprime las estadísticas del mapa junto a los contadores de la funcionalidad.
+         *
+         * @param nombre Nombre con el que se identifica el mapa en el reporte.
+         */
+        void imprimir_estadisticas(const char *nombre) const;
+
+        /**
+         * @brief Escribe las estadísticas del mapa como un objeto JSON.
+         *
+         * @param salida Flujo donde se escribe el JSON.
+         * @param nombre Nombre con el que se identifica el mapa.
+         */
+        void estadisticas_json(std::ostream &salida, const char *nombre) const;
+
+        /**
+         * @brief Iterador a la primera entrada.
+         */
+        iterator begin();
+
+        /**
+         * @brief Iterador que marca el final del recorrido.
+         */
+        iterator end();
+
+        const_iterator begin() const; ///< Iterador de solo lectura a la primera entrada.
+        const_iterator end() const;   ///< Iterador de solo lectura que marca el final.
+};
+
+#include "owning_unordered_map.tpp"
+#endif
@@ -0,0 +1,172 @@
+#ifndef __OWNING_UNORDERED_MAP_TPP__
+#define __OWNING_UNORDERED_MAP_TPP__
+
+#include <new>
+#include <utility>
+#include "owning_unordered_map.hpp"
+#include "performance.hpp"
+
+template <typename Key, typename Value, typename Hash>
+Owning_Unordered_Map<Key, Value, Hash>::Owning_Unordered_Map(size_t size) : m_mapa(size) {}
+
+/**
+ * @brief Destructor. Destruye los valores antes de que el pool libere sus trozos.
+ */
+template <typename Key, typename Value, typename Hash>
+Owning_Unordered_Map<Key, Value, Hash>::~Owning_Unordered_Map()
+{
+    clear_values();
+}
+
+/**
+ * @brief Construye el valor en un bloque del pool. Si la clave ya existía, el valor anterior se
+ * destruye y el nuevo se construye en el mismo bloque, así que los punteros a él siguen siendo válidos.
+ */
+template <typename Key, typename Value, typename Hash>
+template <typename... Args>
+Value *Owning_Unordered_Map<Key, Value, Hash>::emplace(const Key& key, Args&&... args)
+{
+    Value *bloque = m_mapa.find(key);
+    if (bloque != nullptr) {
+        bloque->~Value();
+        try {
+            return new (bloque) Value(std::forward<Args>(args)...);
+        } catch (...) {
+            // El valor anterior ya no existe: la clave sale del mapa
+            m_mapa.erase(key);
+            m_pool.deallocate(bloque);
+            throw;
+        }
+    }
+
+    bloque = m_pool.allocate();
+    Value *value;
+    try {
+        value = new (bloque) Value(std::forward<Args>(args)...);
+    } catch (...) {
+        m_pool.deallocate(bloque);
+        throw;
+    }
+
+    m_mapa.insert(key, value);
+    return value;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value *Owning_Unordered_Map<Key, Value, Hash>::find(const Key& key)
+{
+    return m_mapa.find(key);
+}
+
+template <typename Key, typename Value, typename Hash>
+Value *Owning_Unordered_Map<Key, Value, Hash>::find(const Key& key) const
+{
+    return m_mapa.find(key);
+}
+
+template <typename Key, typename Value, typename Hash>
+void Owning_Unordered_Map<Key, Value, Hash>::find_many(const Key* keys, size_t n, Value** out)
+{
+    m_mapa.find_many(keys, n, out);
+}
+
+/**
+ * @brief Saca la clave del índice, destruye su valor y devuelve el bloque al pool.
+ */
+template <typename Key, typename Value, typename Hash>
+bool Owning_Unordered_Map<Key, Value, Hash>::erase(const Key& key)
+{
+    Value *value = m_mapa.erase(key);
+    if (value == nullptr)
+        return false;
+
+    value->~Value();
+    m_pool.deallocate(value);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+void Owning_Unordered_Map<Key, Value, Hash>::reserve(size_t n)
+{
+    m_mapa.reserve(n);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t Owning_Unordered_Map<Key, Value, Hash>::size() const
+{
+    return m_mapa.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t Owning_Unordered_Map<Key, Value, Hash>::info_map() const
+{
+    return sizeof(*this) - sizeof(m_mapa) + m_mapa.info_map() + m_pool.get_bytes();
+}
+
+/**
+ * @brief Destruye todos los valores recorriendo el arreglo denso del índice y libera los trozos
+ * del pool de una vez, sin devolver los bloques uno por uno.
+ */
+template <typename Key, typename Value, typename Hash>
+void Owning_Unordered_Map<Key, Value, Hash>::clear_values()
+{
+    m_mapa.for_each([](const Key&, Value *value) {
+        value->~Value();
+    });
+    m_mapa.clear();
+    m_pool.release();
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename F>
+bool Owning_Unordered_Map<Key, Value, Hash>::for_each(F&& funcion)
+{
+    return m_mapa.for_each(std::forward<F>(funcion));
+}
+
+template <typename Key, typename Value, typename Hash>
+Estadisticas_Mapa Owning_Unordered_Map<Key, Value, Hash>::estadisticas() const
+{
+    Estadisticas_Mapa estadisticas = m_mapa.estadisticas();
+    estadisticas.bytes_valores = m_pool.get_bytes();
+    estadisticas.bytes_totales = info_map();
+    return estadisticas;
+}
+
+template <typename Key, typename Value, typename Hash>
+void Owning_Unordered_Map<Key, Value, Hash>::imprimir_estadisticas(const char *nombre) const
+{
+    Unordered_Map<Key, Value, Hash>::imprimir_estadisticas(nombre, estadisticas());
+}
+
+template <typename Key, typename Value, typename Hash>
+void Owning_Unordered_Map<Key, Value, Hash>::estadisticas_json(std::ostream &salida, const char *nombre) const
+{
+    Unordered_Map<Key, Value, Hash>::estadisticas_json(salida, nombre, estadisticas());
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Owning_Unordered_Map<Key, Value, Hash>::iterator Owning_Unordered_Map<Key, Value, Hash>::begin()
+{
+    return m_mapa.begin();
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Owning_Unordered_Map<Key, Value, Hash>::iterator Owning_Unordered_Map<Key, Value, Hash>::end()
+{
+    return m_mapa.end();
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Owning_Unordered_Map<Key, Value, Hash>::const_iterator Owning_Unordered_Map<Key, Value, Hash>::begin() const
+{
+    return m_mapa.begin();
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Owning_Unordered_Map<Key, Value, Hash>::const_iterator Owning_Unordered_Map<Key, Value, Hash>::end() const
+{
+    return m_mapa.end();
+}
+
+#endif
@@ -2,21 +2,29 @@
 #define __PERFORMANCE_HPP__
 
 #include <cstddef>
-extern uint32_t g_ciclos;              ///< Contador de ciclos
-extern uint32_t g_tamano;              ///< Tamaño total de objetos en memoria
-extern uint32_t g_strlen_cnt;          ///< Contador de strlen
-extern uint32_t g_memcpy_cnt;          ///< Contador de memcpy
-extern uint32_t g_memcmp_cnt;          ///< Contador de memcmp
-extern uint32_t g_is_digit_cnt;        ///< Contador de isdigit
-extern uint32_t g_getline_cnt;         ///< Contador de getline
-extern uint32_t g_string_find_cnt;     ///< Contador de string::find
-extern uint32_t g_string_substr_cnt;   ///< Contador de string::substr
-extern uint32_t g_std_n_pos_cnt;       ///< Contador de std::npos
-extern uint32_t g_c_string_cnt;          ///< Contador de c_str
-extern uint32_t g_stoi_cnt;           ///< Contador de stoi
-extern uint32_t g_stof_cnt;           ///< Contador de stof
-extern uint32_t g_stoull_cnt;        ///< Contador de stoull
-extern uint32_t g_strcmp_cnt;        ///< Contador de strcmp
-extern uint32_t g_sprintf_cnt;       ///< Contador de sprintf
-extern uint32_t g_string_legnth_cnt; ///< Contador de string::length
+#include <stdint.h>
+
+/**
+ * Contadores de la instrumentación. Son por hilo (thread_local): la aplicación corre en un solo
+ * hilo y los ve igual que antes, y los hilos que usan Concurrent_Unordered_Map cuentan cada uno
+ * en su copia, sin carreras ni una línea de caché compartida entre lectores. constinit evita que
+ * cada acceso pase por la función de inicialización perezosa del thread_local.
+ */
+extern constinit thread_local uint32_t g_ciclos;              ///< Contador de ciclos
+extern constinit thread_local uint32_t g_tamano;              ///< Tamaño total de objetos en memoria
+extern constinit thread_local uint32_t g_strlen_cnt;          ///< Contador de strlen
+extern constinit thread_local uint32_t g_memcpy_cnt;          ///< Contador de memcpy
+extern constinit thread_local uint32_t g_memcmp_cnt;          ///< Contador de memcmp
+extern constinit thread_local uint32_t g_is_digit_cnt;        ///< Contador de isdigit
+extern constinit thread_local uint32_t g_getline_cnt;         ///< Contador de getline
+extern constinit thread_local uint32_t g_string_find_cnt;     ///< Contador de string::find
+extern constinit thread_local uint32_t g_string_substr_cnt;   ///< Contador de string::substr
+extern constinit thread_local uint32_t g_std_n_pos_cnt;       ///< Contador de std::npos
+extern constinit thread_local uint32_t g_c_string_cnt;          ///< Contador de c_str
+extern constinit thread_local uint32_t g_stoi_cnt;           ///< Contador de stoi
+extern constinit thread_local uint32_t g_stof_cnt;           ///< Contador de stof
+extern constinit thread_local uint32_t g_stoull_cnt;        ///< Contador de stoull
+extern constinit thread_local uint32_t g_strcmp_cnt;        ///< Contador de strcmp
+extern constinit thread_local uint32_t g_sprintf_cnt;       ///< Contador de sprintf
+extern constinit thread_local uint32_t g_string_legnth_cnt; ///< Contador de string::length
 #endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef __POOL_ALLOCATOR_HPP__
+#define __POOL_ALLOCATOR_HPP__
+
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * @brief Asignador por bloques (slab) con lista libre para objetos de tamaño fijo.
+ *
+ * Reserva la memoria en trozos (chunks) contiguos de varios bloques, cada uno del tamaño de T.
+ * Los bloques liberados se encadenan en una lista libre y se reutilizan en las siguientes
+ * asignaciones. Cada trozo duplica el tamaño del anterior hasta POOL_BLOQUES_MAXIMOS, así
+ * que un contenedor pequeño hace pocas asignaciones y uno grande hace O(log n).
+ *
+ * release() devuelve todos los trozos de una vez, en O(número de trozos), sin recorrer los objetos.
+ *
+ * @tparam T Tipo de objeto que se almacena en cada bloque.
+ */
+template <typename T>
+class Pool_Allocator {
+private:
+    /**
+     * @brief Bloque del pool: almacena un T o, si está libre, el enlace al siguiente bloque libre.
+     * El primer bloque de cada trozo guarda el enlace al trozo anterior.
+     */
+    union bloque {
+        bloque *siguiente;                          ///< Siguiente bloque libre (o trozo anterior).
+        alignas(T) unsigned char datos[sizeof(T)];  ///< Espacio para el objeto.
+    };
+
+    bloque *m_libres;          ///< Lista de bloques liberados.
+    bloque *m_chunks;          ///< Lista de trozos reservados (enlazados por su primer bloque).
+    bloque *m_siguiente;       ///< Próximo bloque sin usar del trozo actual.
+    size_t m_disponibles;      ///< Bloques sin usar que quedan en el trozo actual.
+    size_t m_bloques_chunk;    ///< Bloques que tendrá el próximo trozo.
+    size_t m_bytes;            ///< Bytes reservados por el pool.
+
+    /**
+     * @brief Reserva un nuevo trozo y lo deja como trozo actual.
+     */
+    void nuevo_chunk();
+
+public:
+    Pool_Allocator(const Pool_Allocator&) = delete; ///< Elimina el constructor de copia.
+    Pool_Allocator& operator=(const Pool_Allocator&) = delete; ///< Elimina el operador de asignación.
+
+    /**
+     * @brief Constructor. No reserva memoria hasta la primera asignación.
+     */
+    Pool_Allocator();
+
+    /**
+     * @brief Destructor. Libera todos los trozos.
+     */
+    ~Pool_Allocator();
+
+    /**
+     * @brief Entrega memoria sin inicializar para un objeto T.
+     * @return Puntero al bloque. El llamador construye el objeto con placement new.
+     */
+    T *allocate();
+
+    /**
+     * @brief Devuelve un bloque al pool. El objeto ya debe estar destruido.
+     * @param ptr Bloque entregado antes por allocate().
+     */
+    void deallocate(T *ptr);
+
+    /**
+     * @brief Libera todos los trozos. Los objetos no se destruyen.
+     *
+     * @warning Solo debe usarse si T se destruye trivialmente o si ya se destruyeron los objetos.
+     */
+    void release();
+
+    /**
+     * @brief Bytes reservados actualmente por el pool.
+     */
+    size_t get_bytes() const;
+};
+
+#include "pool_allocator.tpp"
+
+#endif
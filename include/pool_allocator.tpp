@@ -0,0 +1,108 @@
+/**
+ * @file pool_allocator.tpp
+ * @brief Implementación de la clase Pool_Allocator.
+ */
+#ifndef __POOL_ALLOCATOR_TPP__
+#define __POOL_ALLOCATOR_TPP__
+#include <new>
+#include "pool_allocator.hpp"
+#include "performance.hpp"
+#define POOL_BLOQUES_INICIALES 4 //Bloques del primer trozo: la mayoría de las listas son cortas.
+#define POOL_BLOQUES_MAXIMOS 1024 //Tope de bloques por trozo.
+
+template <typename T>
+Pool_Allocator<T>::Pool_Allocator()
+    : m_libres(nullptr), m_chunks(nullptr), m_siguiente(nullptr),
+      m_disponibles(0), m_bloques_chunk(POOL_BLOQUES_INICIALES), m_bytes(0) {}
+
+template <typename T>
+Pool_Allocator<T>::~Pool_Allocator()
+{
+    release();
+}
+
+/**
+ * @brief Reserva un nuevo trozo. El bloque 0 enlaza con el trozo anterior y el resto queda disponible.
+ */
+template <typename T>
+void Pool_Allocator<T>::nuevo_chunk()
+{
+    bloque *chunk = new bloque[m_bloques_chunk + 1];
+
+    chunk[0].siguiente = m_chunks;
+    m_chunks = chunk;
+    m_siguiente = chunk + 1;
+    m_disponibles = m_bloques_chunk;
+
+    m_bytes += sizeof(bloque) * (m_bloques_chunk + 1);
+    g_tamano += sizeof(bloque) * (m_bloques_chunk + 1);
+
+    if (m_bloques_chunk < POOL_BLOQUES_MAXIMOS)
+        m_bloques_chunk *= 2;
+}
+
+/**
+ * @brief Entrega un bloque: primero de la lista libre y, si está vacía, del trozo actual.
+ */
+template <typename T>
+T *Pool_Allocator<T>::allocate()
+{
+    bloque *b = m_libres;
+    if (b != nullptr) {
+        m_libres = b->siguiente;
+        return reinterpret_cast<T*>(b->datos);
+    }
+
+    if (m_disponibles == 0)
+        nuevo_chunk();
+
+    b = m_siguiente++;
+    m_disponibles--;
+    return reinterpret_cast<T*>(b->datos);
+}
+
+/**
+ * @brief Devuelve un bloque a la lista libre.
+ */
+template <typename T>
+void Pool_Allocator<T>::deallocate(T *ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    bloque *b = reinterpret_cast<bloque*>(ptr);
+    b->siguiente = m_libres;
+    m_libres = b;
+}
+
+/**
+ * @brief Libera todos los trozos recorriendo solo la lista de trozos.
+ */
+template <typename T>
+void Pool_Allocator<T>::release()
+{
+    while (m_chunks != nullptr) {
+        bloque *anterior = m_chunks[0].siguiente;
+        delete[] m_chunks;
+        m_chunks = anterior;
+        g_ciclos++;
+    }
+
+    g_tamano -= m_bytes;
+    m_bytes = 0;
+    m_libres = nullptr;
+    m_siguiente = nullptr;
+    m_disponibles = 0;
+    m_bloques_chunk = POOL_BLOQUES_INICIALES;
+}
+
+/**
+ * @brief Obtiene los bytes reservados por el pool.
+ */
+template <typename T>
+size_t Pool_Allocator<T>::get_bytes() const
+{
+    return m_bytes;
+}
+
+#endif
@@ -3,22 +3,32 @@
 
 #include <stdint.h>
 #include "fecha.hpp"
+#include "intrusive_list.hpp"
+#include "arena_cadenas.hpp"
+
+class Alojamiento;
+class Tabla_Reservas;
 
 /**
  * @brief Representa una reservación en el sistema de alojamientos.
  */
 class Reserva {
 private:
-    Fecha * m_fecha_entrada;       ///< Fecha de entrada al alojamiento.
-    Fecha * m_fecha_salida;      ///< Fecha de salida del alojamiento.
+    Fecha m_fecha_entrada;        ///< Fecha de entrada al alojamiento.
+    Fecha m_fecha_salida;         ///< Fecha de salida del alojamiento.
     uint16_t m_duracion;          ///< Duración de la estancia en noches.
     uint32_t m_codigo_reserva;    ///< Código único de la reservación.
     uint32_t m_codigo_alojamiento;///< Código del alojamiento reservado.
     uint64_t m_documento_huesped; ///< Documento del huésped (ID).
     char m_metodo_pago;           ///< Método de pago: 'P' (PSE) o 'T' (Tarjeta de crédito).
-    Fecha * m_fecha_pago;          ///< Fecha en que se realizó el pago.
+    Fecha m_fecha_pago;           ///< Fecha en que se realizó el pago.
     float m_monto;                ///< Monto total pagado.
-    char * m_anotaciones;         ///< Anotaciones del huésped (máx. 1000 caracteres).
+    Cadena m_anotaciones;         ///< Anotaciones del huésped (máx. 1000 caracteres), guardadas en la arena.
+    Alojamiento * m_alojamiento;  ///< Alojamiento al que está asignada, o nullptr.
+    Intrusive_Hook<Reserva> m_enlace_alojamiento; ///< Enlace en la lista de reservas del alojamiento.
+    Intrusive_Hook<Reserva> m_enlace_huesped;     ///< Enlace en la lista de reservas del huésped.
+    Tabla_Reservas * m_tabla;     ///< Tabla por columnas que tiene una fila de esta reserva, o nullptr.
+    uint32_t m_fila;              ///< Fila de la reserva en m_tabla.
 
 public:
     /**
@@ -32,28 +42,59 @@ public:
      * @param fecha_pago Fecha del pago.
      * @param monto Monto del pago.
      * @param notas Anotaciones del huésped.
+     * @param arena Arena donde se copian las anotaciones; debe vivir más que la reserva.
      */
-    Reserva(Fecha *fecha_entrada, Fecha *salida, uint16_t duracion,
+    Reserva(const Fecha &fecha_entrada, const Fecha &salida, uint16_t duracion,
             uint32_t cod_reserva, uint32_t cod_alojamiento,
             uint64_t doc_huesped, char metodo_pago,
-            Fecha *fecha_pago, float monto,
-            const char* notas);
+            const Fecha &fecha_pago, float monto,
+            const char* notas, Arena_Cadenas *arena);
 
    
     /**
      * @brief Destructor de la clase Reserva.
+     * La reserva sale de las listas en las que siga enlazada y de su tabla por columnas.
      */
     ~Reserva();
 
+    /**
+     * @brief Enlace que usan las listas de reservas de los alojamientos.
+     */
+    static Intrusive_Hook<Reserva> Reserva::* enlace_alojamiento();
+
+    /**
+     * @brief Enlace que usan las listas de reservas de los huéspedes.
+     */
+    static Intrusive_Hook<Reserva> Reserva::* enlace_huesped();
+
+    /**
+     * @brief Obtiene el alojamiento al que está asignada la reserva.
+     * @return Puntero al alojamiento, o nullptr si no está asignada.
+     */
+    Alojamiento* get_alojamiento() const;
+
+    /**
+     * @brief Asigna el alojamiento de la reserva.
+     * @param alojamiento Alojamiento que guarda la reserva, o nullptr.
+     */
+    void set_alojamiento(Alojamiento* alojamiento);
+
+    /**
+     * @brief Registra la fila que ocupa la reserva en una tabla por columnas.
+     * @param tabla Tabla que tiene la fila, o nullptr si la reserva sale de ella.
+     * @param fila Índice de la fila.
+     */
+    void set_fila(Tabla_Reservas* tabla, uint32_t fila);
+
     /** 
      * @brief Obtiene la fecha de entrada. 
     */
-    const Fecha* get_fecha_entrada() const;
+    const Fecha& get_fecha_entrada() const;
     
     /** 
      * @brief Obtiene la fecha de salida. 
     */
-    const Fecha* get_fecha_salida() const;
+    const Fecha& get_fecha_salida() const;
     /** 
      * @brief Obtiene la duración en noches. 
     */
@@ -82,7 +123,7 @@ public:
     /** 
      * @brief Obtiene la fecha del pago. 
     */
-    const Fecha* get_fecha_pago() const;
+    const Fecha& get_fecha_pago() const;
 
     /** 
      * @brief Obtiene el monto pagado. 
@@ -0,0 +1,122 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * @brief Arreglo dinámico con los primeros N elementos guardados dentro del propio objeto.
+ *
+ * Mientras no pase de N elementos no pide memoria al heap; al superarlos se muda a un bloque
+ * contiguo que crece al doble. Los elementos quedan seguidos en memoria, así que recorrerlos es
+ * un barrido lineal que el prefetcher del procesador puede seguir, a diferencia de una lista enlazada.
+ *
+ * @tparam T Tipo de dato almacenado.
+ * @tparam N Número de elementos que caben sin pedir memoria.
+ */
+template <typename T, uint32_t N>
+class Small_Vector {
+    static_assert(N > 0, "Small_Vector necesita al menos un elemento interno");
+private:
+    alignas(T) unsigned char m_local[N * sizeof(T)]; ///< Almacenamiento de los primeros N elementos.
+    T* m_datos;            ///< Elementos: apunta a m_local o a un bloque del heap.
+    uint32_t m_size;       ///< Número de elementos almacenados.
+    uint32_t m_capacidad;  ///< Elementos que caben sin crecer.
+
+    /**
+     * @brief Indica si los elementos están en el almacenamiento interno.
+     */
+    bool es_local() const;
+
+    /**
+     * @brief Muda los elementos a un bloque del heap con la capacidad indicada.
+     * @param capacidad Nueva capacidad, mayor que la actual.
+     */
+    void crecer(uint32_t capacidad);
+
+public:
+    Small_Vector(const Small_Vector&) = delete; ///< Elimina el constructor de copia.
+    Small_Vector& operator=(const Small_Vector&) = delete; ///< Elimina el operador de asignación.
+
+    /**
+     * @brief Constructor. El arreglo empieza vacío y sin memoria del heap.
+     */
+    Small_Vector();
+
+    /**
+     * @brief Destructor. Destruye los elementos y libera el bloque del heap si lo hay.
+     */
+    ~Small_Vector();
+
+    /**
+     * @brief Agrega un elemento al final.
+     * @param value Elemento a agregar.
+     */
+    void push_back(const T& value);
+
+    /**
+     * @brief Elimina la primera aparición de un elemento conservando el orden de los demás.
+     * @param value Elemento a eliminar.
+     * @return true si se encontró y eliminó el elemento.
+     */
+    bool remove(const T& value);
+
+    /**
+     * @brief Garantiza capacidad para al menos n elementos.
+     * @param n Número de elementos que se espera almacenar.
+     */
+    void reserve(uint32_t n);
+
+    /**
+     * @brief Destruye todos los elementos. Conserva la capacidad.
+     */
+    void clear();
+
+    /**
+     * @brief Acceso al elemento en la posición indicada (sin validar el índice).
+     */
+    T& operator[](uint32_t i);
+
+    /**
+     * @brief Acceso de solo lectura al elemento en la posición indicada (sin validar el índice).
+     */
+    const T& operator[](uint32_t i) const;
+
+    /**
+     * @brief Puntero al primer elemento.
+     */
+    T* begin();
+
+    /**
+     * @brief Puntero después del último elemento.
+     */
+    T* end();
+
+    /**
+     * @brief Puntero de solo lectura al primer elemento.
+     */
+    const T* begin() const;
+
+    /**
+     * @brief Puntero de solo lectura después del último elemento.
+     */
+    const T* end() const;
+
+    /**
+     * @brief Obtiene el número de elementos almacenados.
+     */
+    uint32_t get_size() const;
+
+    /**
+     * @brief Verifica si el arreglo está vacío.
+     */
+    bool is_empty() const;
+
+    /**
+     * @brief Obtiene los bytes pedidos al heap (0 mientras quepa en el almacenamiento interno).
+     */
+    size_t get_bytes() const;
+};
+
+#include "small_vector.tpp"
+#endif
@@ -0,0 +1,133 @@
+/**
+ * @file small_vector.tpp
+ * @brief Implementación de la clase Small_Vector.
+ */
+#ifndef __SMALL_VECTOR_TPP__
+#define __SMALL_VECTOR_TPP__
+#include "small_vector.hpp"
+#include <new>
+#include <utility>
+#include "performance.hpp"
+
+template <typename T, uint32_t N>
+Small_Vector<T, N>::Small_Vector()
+    : m_datos(reinterpret_cast<T*>(m_local)), m_size(0), m_capacidad(N) {}
+
+template <typename T, uint32_t N>
+Small_Vector<T, N>::~Small_Vector() {
+    clear();
+    if (!es_local())
+        ::operator delete(m_datos);
+}
+
+template <typename T, uint32_t N>
+bool Small_Vector<T, N>::es_local() const {
+    return m_datos == reinterpret_cast<const T*>(m_local);
+}
+
+/**
+ * @brief Mueve los elementos al nuevo bloque y libera el anterior si era del heap.
+ */
+template <typename T, uint32_t N>
+void Small_Vector<T, N>::crecer(uint32_t capacidad) {
+    T* nuevos = static_cast<T*>(::operator new(capacidad * sizeof(T)));
+
+    for (uint32_t i = 0; i < m_size; ++i, g_ciclos++) {
+        new (nuevos + i) T(std::move(m_datos[i]));
+        m_datos[i].~T();
+    }
+
+    if (!es_local())
+        ::operator delete(m_datos);
+
+    m_datos = nuevos;
+    m_capacidad = capacidad;
+}
+
+template <typename T, uint32_t N>
+void Small_Vector<T, N>::push_back(const T& value) {
+    if (m_size == m_capacidad)
+        crecer(m_capacidad > 0 ? m_capacidad * 2 : 4);
+
+    new (m_datos + m_size) T(value);
+    m_size++;
+}
+
+/**
+ * @brief Corre una posición hacia atrás los elementos que siguen al eliminado.
+ */
+template <typename T, uint32_t N>
+bool Small_Vector<T, N>::remove(const T& value) {
+    for (uint32_t i = 0; i < m_size; ++i, g_ciclos++) {
+        if (!(m_datos[i] == value))
+            continue;
+
+        for (uint32_t j = i + 1; j < m_size; ++j, g_ciclos++)
+            m_datos[j - 1] = std::move(m_datos[j]);
+
+        m_size--;
+        m_datos[m_size].~T();
+        return true;
+    }
+    return false;
+}
+
+template <typename T, uint32_t N>
+void Small_Vector<T, N>::reserve(uint32_t n) {
+    if (n > m_capacidad)
+        crecer(n);
+}
+
+template <typename T, uint32_t N>
+void Small_Vector<T, N>::clear() {
+    for (uint32_t i = 0; i < m_size; ++i)
+        m_datos[i].~T();
+    m_size = 0;
+}
+
+template <typename T, uint32_t N>
+T& Small_Vector<T, N>::operator[](uint32_t i) {
+    return m_datos[i];
+}
+
+template <typename T, uint32_t N>
+const T& Small_Vector<T, N>::operator[](uint32_t i) const {
+    return m_datos[i];
+}
+
+template <typename T, uint32_t N>
+T* Small_Vector<T, N>::begin() {
+    return m_datos;
+}
+
+template <typename T, uint32_t N>
+T* Small_Vector<T, N>::end() {
+    return m_datos + m_size;
+}
+
+template <typename T, uint32_t N>
+const T* Small_Vector<T, N>::begin() const {
+    return m_datos;
+}
+
+template <typename T, uint32_t N>
+const T* Small_Vector<T, N>::end() const {
+    return m_datos + m_size;
+}
+
+template <typename T, uint32_t N>
+uint32_t Small_Vector<T, N>::get_size() const {
+    return m_size;
+}
+
+template <typename T, uint32_t N>
+bool Small_Vector<T, N>::is_empty() const {
+    return m_size == 0;
+}
+
+template <typename T, uint32_t N>
+size_t Small_Vector<T, N>::get_bytes() const {
+    return es_local() ? 0 : m_capacidad * sizeof(T);
+}
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef __TABLA_RESERVAS_HPP__
+#define __TABLA_RESERVAS_HPP__
+#include <stdint.h>
+#include <cstddef>
+#include "fecha.hpp"
+#include "performance.hpp"
+
+class Reserva;
+
+#define CAPACIDAD_INICIAL_TABLA 16 // Filas que reserva la tabla la primera vez que crece
+
+/**
+ * @class Tabla_Reservas
+ * @brief Tabla de reservas guardada por columnas (una estructura de arreglos).
+ *
+ * Las columnas que usa el recorrido del histórico (entrada y noches) viven en arreglos contiguos,
+ * así decidir qué reservas ya salieron lee 6 bytes por reserva en vez de saltar de objeto en
+ * objeto. El resto de los datos se queda en el objeto Reserva, al que cada fila apunta.
+ *
+ * La tabla no es dueña de las reservas: cada Reserva sabe en qué fila está y la borra al
+ * destruirse. Borrar mueve la última fila al hueco, así que el orden de las filas no es estable.
+ */
+class Tabla_Reservas
+{
+    public:
+        Tabla_Reservas(const Tabla_Reservas&) = delete; ///< Elimina el constructor de copia.
+        Tabla_Reservas& operator=(const Tabla_Reservas&) = delete; ///< Elimina el operador de asignación.
+
+        /**
+         * @brief Constructor. La tabla empieza vacía y sin memoria.
+         */
+        Tabla_Reservas();
+
+        /**
+         * @brief Destructor. Suelta las reservas que sigan en la tabla, pero no las destruye.
+         */
+        ~Tabla_Reservas();
+
+        /**
+         * @brief Garantiza espacio para al menos n filas.
+         * @param n Número de filas que se espera guardar.
+         */
+        void reserve(uint32_t n);
+
+        /**
+         * @brief Agrega una fila con los datos de una reserva y se la asigna.
+         * @param reserva Reserva a agregar; no debe estar en otra tabla.
+         * @return Índice de la nueva fila.
+         */
+        uint32_t agregar(Reserva *reserva);
+
+        /**
+         * @brief Borra una fila en O(1) moviendo la última a su lugar.
+         * @param indice Índice de la fila a borrar.
+         */
+        void eliminar(uint32_t indice);
+
+        /**
+         * @brief Suelta todas las reservas de la tabla.
+         */
+        void clear();
+
+        /**
+         * @brief Obtiene el número de filas.
+         */
+        uint32_t get_size() const;
+
+        /**
+         * @brief Obtiene los bytes que ocupan las columnas.
+         */
+        size_t get_bytes() const;
+
+        /**
+         * @brief Recorre las reservas cuya salida es anterior a una fecha.
+         *
+         * Solo lee las columnas de entrada y noches; la columna de reservas se toca solo en las
+         * filas que cumplen. La función no debe borrar filas de la tabla.
+         *
+         * @param limite Fecha límite (excluida).
+         * @param funcion Función que recibe un Reserva* por cada fila que cumple.
+         */
+        template <typename Funcion>
+        void for_each_salida_antes(const Fecha &limite, Funcion funcion) const;
+
+    private:
+        int32_t *m_entrada;            ///< Día serial de entrada.
+        uint16_t *m_noches;            ///< Duración en noches.
+        Reserva **m_reservas;          ///< Reserva de cada fila, con el resto de sus datos.
+        uint32_t m_size;               ///< Número de filas.
+        uint32_t m_capacidad;          ///< Filas que caben sin crecer.
+
+        /**
+         * @brief Muda todas las columnas a arreglos con la capacidad indicada.
+         * @param capacidad Nueva capacidad, mayor que la actual.
+         */
+        void crecer(uint32_t capacidad);
+};
+
+template <typename Funcion>
+void Tabla_Reservas::for_each_salida_antes(const Fecha &limite, Funcion funcion) const
+{
+    const int32_t dia_limite = limite.get_dia_serial();
+    for (uint32_t i = 0; i < m_size; ++i, g_ciclos++) {
+        if (m_entrada[i] + m_noches[i] < dia_limite)
+            funcion(m_reservas[i]);
+    }
+}
+
+#endif
@@ -2,68 +2,217 @@
 #define __UNORDERED_MAP_HPP__
 
 #include <cstddef>
+#include <iterator>
+#include <ostream>
 #include <stdint.h>
+#include <type_traits>
+#include "hash_policy.hpp"
+
+#define HISTOGRAMA_SONDEO 8 //Barras del histograma de sondeo: distancias 1..7 y una última para 8 o más.
+
+/**
+ * @brief Estado de salud de un Unordered_Map. Sirve para ajustar RESIZE/CARGA_MAXIMA y para
+ * detectar distribuciones de claves patológicas (cadenas de sondeo largas).
+ */
+struct Estadisticas_Mapa {
+    size_t casillas;                          ///< Casillas del índice (más las del índice anterior si hay migración).
+    size_t ocupadas;                          ///< Elementos almacenados.
+    double factor_carga;                      ///< ocupadas / casillas del índice actual.
+    uint32_t sondeo_maximo;                   ///< Mayor distancia de sondeo (1 = en su casilla ideal).
+    size_t histograma[HISTOGRAMA_SONDEO];     ///< Elementos por distancia de sondeo; la última barra acumula las mayores.
+    bool migrando;                            ///< true si hay un índice anterior pendiente de migrar.
+    size_t bytes_indice;                      ///< Bytes de los índices hash.
+    size_t bytes_entradas;                    ///< Bytes reservados para el arreglo denso.
+    size_t bytes_valores;                     ///< Bytes reservados para los valores si el mapa es su dueño (0 si no).
+    size_t bytes_totales;                     ///< Bytes del mapa completo (objeto, índices, entradas y valores propios).
+};
 
 /**
  * @brief Implementación de un mapa no ordenado (hash map).
- * 
- * Este mapa utiliza una tabla hash con resolución de colisiones por encadenamiento.
- * Los elementos se almacenan en listas enlazadas dentro de cada índice de la tabla.
- * 
+ *
+ * Los pares clave-valor se guardan en un arreglo denso y contiguo (m_entradas), sin huecos.
+ * Aparte hay un índice hash de direccionamiento abierto con sondeo lineal y política Robin Hood:
+ * cada casilla del índice guarda 32 bits del hash y la posición de su entrada en el arreglo denso.
+ * Al insertar, un elemento "rico" (cerca de su casilla ideal) cede su lugar a uno "pobre"
+ * (lejos de la suya), lo que mantiene las cadenas de sondeo cortas. El borrado desplaza hacia atrás
+ * las casillas siguientes, por lo que no se necesitan lápidas, y en el arreglo denso mueve la última
+ * entrada al hueco (swap con la última).
+ *
+ * Así, recorrer el mapa (for_each, iteradores) es un barrido lineal de m_count entradas, sin pasar
+ * por casillas vacías, y el hash guardado en el índice descarta la mayoría de colisiones sin tocar
+ * la clave.
+ *
+ * Cuando el factor de carga supera CARGA_MAXIMA el índice duplica su tamaño, pero no se
+ * rehashea de una vez: el índice anterior se conserva y cada insert/find/erase migra unas pocas
+ * casillas (PASOS_MIGRACION) al nuevo. Mientras dura la migración las búsquedas consultan ambos.
+ * Como el hash está guardado, migrar una casilla no vuelve a calcularlo.
+ *
+ * El número de casillas es siempre una potencia de dos, así que el índice se obtiene con una
+ * máscara sobre el hash en lugar de una división. El hash lo define la política Hash, que se
+ * elige en tiempo de compilación según el tipo de la clave (ver hash_policy.hpp).
+ *
  * @tparam Key Tipo de la clave.
  * @tparam Value Tipo del valor asociado a cada clave.
+ * @tparam Hash Política de hash e igualdad de las claves.
  */
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Hash = Hash_Policy<Key>>
 class Unordered_Map {
-    private:
+    public:
         /**
-         * @brief Estructura interna que almacena una clave, su valor asociado y un puntero al siguiente par clave-valor.
+         * @brief Entrada del arreglo denso. Almacena la clave y el puntero a su valor.
          */
-        struct key_value_pair {
-            Key key;            ///< Clave del par clave-valor.
-            Value *value;        ///< Recibe puntero al valor asociado a la clave.
-            key_value_pair* next; ///< Puntero al siguiente par clave-valor en caso de colisión.
+        struct entrada {
+            Key key;             ///< Clave almacenada.
+            Value *value;        ///< Puntero al valor asociado a la clave.
+        };
 
-            /**
-             * @brief Constructor de la estructura key_value_pair.
-             * 
-             * @param k Clave del par clave-valor.
-             * @param v Valor asociado a la clave.
-             */
-            key_value_pair(const Key& k, Value *v) : key(k), value(v), next(nullptr) {}
+    private:
+        /**
+         * @brief Casilla del índice hash.
+         */
+        struct slot {
+            uint32_t hash;       ///< 32 bits bajos del hash de la clave.
+            uint32_t indice;     ///< Posición de la entrada en m_entradas (CASILLA_VACIA si está vacía).
         };
 
-        key_value_pair **m_table; ///< Tabla hash que contiene los pares clave-valor.
-        size_t m_size; ///< Tamaño actual de la tabla hash.
-    
+        entrada *m_entradas; ///< Arreglo denso con los pares clave-valor.
+        size_t m_capacidad;  ///< Capacidad del arreglo denso.
+        size_t m_count;      ///< Número de elementos almacenados.
+
+        slot *m_table; ///< Índice hash actual.
+        size_t m_size; ///< Número de casillas del índice (potencia de dos).
+
+        slot *m_anterior; ///< Índice anterior que se está migrando a m_table (nullptr si no hay migración en curso).
+        size_t m_size_anterior; ///< Número de casillas del índice anterior.
+        size_t m_count_anterior; ///< Casillas ocupadas que aún quedan por migrar en el índice anterior.
+        size_t m_migracion; ///< Próxima casilla del índice anterior que se va a migrar.
+
         /**
-         * @brief Función hash que calcula el índice para una clave utilizando el algoritmo djb2.
-         * 
-         * @param key La clave para la cual se calculará el índice.
-         * @return El índice calculado en la tabla hash.
+         * @brief Función hash que calcula el valor hash de una clave con la política Hash.
+         *
+         * @param key La clave para la cual se calculará el hash.
+         * @return El valor hash de la clave (sin reducir al tamaño de la tabla).
          */
         size_t hash_fuction(const Key& key) const;
 
+        /**
+         * @brief Redondea un número de casillas a la siguiente potencia de dos.
+         *
+         * @param n Número mínimo de casillas.
+         * @return La menor potencia de dos mayor o igual que n.
+         */
+        static size_t potencia_de_dos(size_t n);
+
+        /**
+         * @brief Distancia de sondeo + 1 de una casilla ocupada respecto a su casilla ideal.
+         *
+         * @param index Posición de la casilla.
+         * @param hash Hash guardado en la casilla.
+         * @param size Número de casillas del índice.
+         */
+        static uint32_t distancia(size_t index, uint32_t hash, size_t size);
+
+        /**
+         * @brief Reserva un índice con todas sus casillas vacías.
+         *
+         * @param size Número de casillas.
+         * @return Puntero al nuevo índice.
+         */
+        slot *crear_tabla(size_t size);
+
+        /**
+         * @brief Cambia la capacidad del arreglo denso, conservando sus entradas.
+         *
+         * @param capacidad Nueva capacidad (mayor o igual que m_count).
+         */
+        void redimensionar_entradas(size_t capacidad);
+
+        /**
+         * @brief Busca la casilla de una clave en un índice.
+         *
+         * @param tabla Índice donde buscar.
+         * @param size Número de casillas del índice.
+         * @param key Clave a buscar.
+         * @return Índice de la casilla, o size si la clave no está.
+         */
+        size_t buscar_en(const slot *tabla, size_t size, const Key& key) const;
+
+        /**
+         * @brief Busca la casilla de una clave cuyo hash ya se calculó.
+         *
+         * @param tabla Índice donde buscar.
+         * @param size Número de casillas del índice.
+         * @param key Clave a buscar.
+         * @param hash Hash completo de la clave.
+         * @return Índice de la casilla, o size si la clave no está.
+         */
+        size_t buscar_con_hash(const slot *tabla, size_t size, const Key& key, size_t hash) const;
+
+        /**
+         * @brief Busca la casilla que apunta a una posición concreta del arreglo denso.
+         *
+         * @param tabla Índice donde buscar.
+         * @param size Número de casillas del índice.
+         * @param hash Hash de la clave de la entrada.
+         * @param indice Posición de la entrada en m_entradas.
+         * @return Índice de la casilla, o size si no está en este índice.
+         */
+        size_t buscar_indice(const slot *tabla, size_t size, uint32_t hash, uint32_t indice) const;
+
+        /**
+         * @brief Ubica una casilla en un índice usando la política Robin Hood, sin verificar si la clave ya existe.
+         *
+         * @param tabla Índice donde se ubicará.
+         * @param size Número de casillas del índice.
+         * @param entrante Casilla a ubicar.
+         */
+        void ubicar(slot *tabla, size_t size, slot entrante);
+
+        /**
+         * @brief Vacía una casilla desplazando hacia atrás las casillas siguientes de su cadena.
+         *
+         * @param tabla Índice de la casilla.
+         * @param size Número de casillas del índice.
+         * @param index Casilla a vaciar.
+         */
+        void vaciar_casilla(slot *tabla, size_t size, size_t index);
+
+        /**
+         * @brief Mueve hasta PASOS_MIGRACION casillas del índice anterior al actual.
+         * Cuando el índice anterior queda vacío se libera.
+         *
+         * @param pasos Número máximo de casillas a procesar.
+         */
+        void migrar(size_t pasos);
+
+        /**
+         * @brief Inicia el crecimiento del índice. El índice actual pasa a ser el anterior y se
+         * migra poco a poco en las siguientes operaciones.
+         *
+         * @param nuevo_size Número de casillas del nuevo índice.
+         */
+        void crecer(size_t nuevo_size);
+
     public:
         Unordered_Map(const Unordered_Map&) = delete; ///< Elimina el constructor de copia.
         Unordered_Map& operator=(const Unordered_Map&) = delete; ///< Elimina el operador de asignación.
         /**
          * @brief Constructor de Unordered_Map.
-         * Inicializa la tabla hash, estableciendo todos los punteros a nullptr.
-         * @param size Tamaño de la tabla hash.
+         * Inicializa el índice hash con todas las casillas vacías y reserva el arreglo denso.
+         * @param size Número de elementos que se espera almacenar.
          */
         Unordered_Map(size_t size);
-        
+
         /**
          * @brief Destructor de Unordered_Map.
-         * Libera la memoria ocupada por los elementos almacenados en la tabla hash.
+         * Libera el índice y el arreglo denso. Los valores los libera clear_values().
          */
         ~Unordered_Map();
 
         /**
          * @brief Inserta un nuevo par clave-valor en la tabla hash.
          * Si la clave ya existe, actualiza su valor.
-         * 
+         *
          * @param key Clave que se desea insertar.
          * @param value Valor asociado a la clave.
          */
@@ -71,41 +220,209 @@ class Unordered_Map {
 
         /**
          * @brief Busca un valor asociado a una clave en la tabla hash.
-         * 
+         *
          * @param key La clave para la cual se desea encontrar el valor.
          * @return Un puntero al valor asociado a la clave, o nullptr si no se encuentra.
          */
         Value* find(const Key& key);
 
+        /**
+         * @brief Busca un valor sin migrar casillas, por lo que no modifica el mapa.
+         * Permite que varios lectores consulten el mapa a la vez (ver Concurrent_Unordered_Map).
+         *
+         * @param key La clave para la cual se desea encontrar el valor.
+         * @return Un puntero al valor asociado a la clave, o nullptr si no se encuentra.
+         */
+        Value* find(const Key& key) const;
+
+        /**
+         * @brief Busca un lote de claves.
+         *
+         * Calcula primero el hash de un grupo de claves y precarga (prefetch) sus casillas ideales;
+         * luego resuelve las búsquedas. Así los fallos de caché de las distintas claves se solapan
+         * en lugar de esperarse uno tras otro.
+         *
+         * @param keys Claves a buscar.
+         * @param n Número de claves.
+         * @param out Arreglo de n posiciones donde se deja el valor de cada clave (nullptr si no está).
+         */
+        void find_many(const Key* keys, size_t n, Value** out);
+
         /**
          * @brief Elimina un par clave-valor de la tabla hash.
-         * 
+         *
          * @param key Clave del elemento que se desea eliminar.
          * @return Un puntero al valor eliminado o nullptr si no se encuentra. Será liberado por el llamador.
          */
         Value *erase(const Key& key);
 
         /**
-         * @brief Devuelve un aproximado del tamaño en memoria de la tabla hash.
-         * 
+         * @brief Garantiza capacidad para al menos n elementos sin superar el factor de carga inicial.
+         *
+         * Pensado para que los cargadores dimensionen el mapa antes de insertar. Si hay una migración
+         * en curso se completa antes de redimensionar.
+         *
+         * @param n Número de elementos que se espera almacenar.
+         */
+        void reserve(size_t n);
+
+        /**
+         * @brief Devuelve el número de elementos almacenados.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Devuelve el tamaño en memoria de la tabla hash: el objeto, sus índices y el
+         * arreglo denso. No incluye los valores apuntados.
          */
         size_t info_map() const;
 
+        /**
+         * @brief Recorre los índices y calcula el estado de salud del mapa.
+         *
+         * @return Ocupación, factor de carga, histograma de sondeo y memoria del mapa.
+         */
+        Estadisticas_Mapa estadisticas() const;
+
+        /**
+         * @brief Imprime las estadísticas del mapa junto a los contadores de la funcionalidad.
+         *
+         * @param nombre Nombre con el que se identifica el mapa en el reporte.
+         */
+        void imprimir_estadisticas(const char *nombre) const;
+
+        /**
+         * @brief Imprime unas estadísticas ya calculadas.
+         *
+         * @param nombre Nombre con el que se identifica el mapa en el reporte.
+         * @param e Estadísticas a imprimir.
+         */
+        static void imprimir_estadisticas(const char *nombre, const Estadisticas_Mapa &e);
+
+        /**
+         * @brief Escribe las estadísticas del mapa como un objeto JSON.
+         *
+         * @param salida Flujo donde se escribe el JSON.
+         * @param nombre Nombre con el que se identifica el mapa.
+         */
+        void estadisticas_json(std::ostream &salida, const char *nombre) const;
+
+        /**
+         * @brief Escribe unas estadísticas ya calculadas como un objeto JSON.
+         *
+         * @param salida Flujo donde se escribe el JSON.
+         * @param nombre Nombre con el que se identifica el mapa.
+         * @param e Estadísticas a escribir.
+         */
+        static void estadisticas_json(std::ostream &salida, const char *nombre, const Estadisticas_Mapa &e);
+
         /**
          * @brief Limpia la memoria ocupada por los valores de la tabla hash.
-         * 
+         *
          * Esta función libera la memoria ocupada (dinámica) por los valores almacenados en la tabla hash.
-         * 
+         *
          */
         void clear_values();
 
         /**
-         * @brief Recorre la tabla hash y aplica una función a cada par clave-valor.
-         * 
-         * @param callback Función que se aplicará a cada par clave-valor.
-         * @param data Datos adicionales que se pasarán a la función callback.
+         * @brief Vacía el mapa sin liberar los valores ni reducir la capacidad.
+         */
+        void clear();
+
+        /**
+         * @brief Recorre el arreglo denso y aplica una función a cada par clave-valor.
+         *
+         * La función (lambda o functor) recibe (clave, valor) y el compilador la instancia en línea,
+         * sin llamadas indirectas. Si la función devuelve bool, retornar false detiene el recorrido.
+         * La función no debe insertar ni eliminar elementos del mapa.
+         *
+         * @param funcion Función que se aplicará a cada par clave-valor.
+         * @return true si se recorrió todo el mapa, false si la función detuvo el recorrido.
+         */
+        template <typename F>
+        bool for_each(F&& funcion);
+
+        class const_iterator;
+
+        /**
+         * @brief Iterador sobre las entradas del arreglo denso.
+         * Se accede a la clave y al valor con it->key e it->value.
+         */
+        class iterator {
+            public:
+                typedef std::forward_iterator_tag iterator_category; ///< Solo avanza.
+                typedef entrada value_type;                          ///< Par clave-valor.
+                typedef std::ptrdiff_t difference_type;              ///< Distancia entre iteradores.
+                typedef entrada* pointer;                            ///< Puntero a la entrada.
+                typedef entrada& reference;                          ///< Referencia a la entrada.
+
+                /**
+                 * @brief Construye un iterador sobre una entrada.
+                 * @param actual Entrada actual.
+                 */
+                iterator(entrada *actual = nullptr);
+
+                entrada& operator*() const;            ///< Entrada actual.
+                entrada* operator->() const;           ///< Acceso a la clave y al valor de la entrada actual.
+                iterator& operator++();                ///< Avanza a la siguiente entrada.
+                iterator operator++(int);              ///< Avanza y devuelve la posición anterior.
+                bool operator==(const iterator &otro) const; ///< Compara posiciones.
+                bool operator!=(const iterator &otro) const; ///< Compara posiciones.
+
+            private:
+                entrada *m_actual; ///< Entrada actual.
+
+                friend class const_iterator;
+        };
+
+        /**
+         * @brief Iterador de solo lectura sobre las entradas del arreglo denso.
          */
-        void for_each(void (*callback)(Key, Value*, void*), void *data);
+        class const_iterator {
+            public:
+                typedef std::forward_iterator_tag iterator_category; ///< Solo avanza.
+                typedef entrada value_type;                          ///< Par clave-valor.
+                typedef std::ptrdiff_t difference_type;              ///< Distancia entre iteradores.
+                typedef const entrada* pointer;                      ///< Puntero a la entrada.
+                typedef const entrada& reference;                    ///< Referencia a la entrada.
+
+                /**
+                 * @brief Construye un iterador sobre una entrada.
+                 * @param actual Entrada actual.
+                 */
+                const_iterator(const entrada *actual = nullptr);
+
+                /**
+                 * @brief Convierte un iterador en uno de solo lectura.
+                 * @param otro Iterador a convertir.
+                 */
+                const_iterator(const iterator &otro);
+
+                const entrada& operator*() const;      ///< Entrada actual.
+                const entrada* operator->() const;     ///< Acceso a la clave y al valor de la entrada actual.
+                const_iterator& operator++();          ///< Avanza a la siguiente entrada.
+                const_iterator operator++(int);        ///< Avanza y devuelve la posición anterior.
+                bool operator==(const const_iterator &otro) const; ///< Compara posiciones.
+                bool operator!=(const const_iterator &otro) const; ///< Compara posiciones.
+
+            private:
+                const entrada *m_actual; ///< Entrada actual.
+        };
+
+        /**
+         * @brief Iterador a la primera entrada.
+         */
+        iterator begin();
+
+        /**
+         * @brief Iterador que marca el final del recorrido.
+         */
+        iterator end();
+
+        const_iterator begin() const;  ///< Iterador de solo lectura a la primera entrada.
+        const_iterator end() const;    ///< Iterador de solo lectura que marca el final.
+        const_iterator cbegin() const; ///< Iterador de solo lectura a la primera entrada.
+        const_iterator cend() const;   ///< Iterador de solo lectura que marca el final.
 };
 
 #include "unordered_map.tpp"
@@ -2,211 +2,792 @@
 #define __UNORDERED_MAP_TPP__
 
 #include <iostream>
+#include <new>
+#include <stdint.h>
 #include "unordered_map.hpp"
 #include "performance.hpp"
-#define RESIZE(size) ((size/(0.75)) + 1) //Ya que no hacemos rehashing, se redimensiona la tabla hash al 75% de su tamaño original.
+#define RESIZE(size) ((size/(0.75)) + 1) //Se reserva espacio para que la tabla arranque al 75% de su capacidad.
+#define CARGA_MAXIMA 0.85 //Por encima de este factor de carga las cadenas de sondeo se alargan y la tabla crece.
+#define PASOS_MIGRACION 4 //Casillas de la tabla anterior que se migran en cada insert/find/erase.
+#define LOTE_PREFETCH 16 //Claves de find_many cuyas casillas se precargan antes de resolverlas.
+#define CASILLA_VACIA UINT32_MAX //Marca de casilla vacía en el índice.
 
 /**
  * @brief Constructor de Unordered_Map.
- * Inicializa la tabla hash a nullptr en todas sus posiciones.
+ * Inicializa todas las casillas del índice como vacías y reserva el arreglo denso para size elementos.
  */
-template <typename Key, typename Value>
-Unordered_Map<Key, Value>::Unordered_Map(size_t size)
-    : m_size(RESIZE(size))
+template <typename Key, typename Value, typename Hash>
+Unordered_Map<Key, Value, Hash>::Unordered_Map(size_t size)
+    : m_entradas(nullptr), m_capacidad(0), m_count(0),
+      m_size(potencia_de_dos(RESIZE(size))), m_anterior(nullptr),
+      m_size_anterior(0), m_count_anterior(0), m_migracion(0)
 {
-    m_table = new key_value_pair*[m_size];
-    g_tamano += sizeof(key_value_pair*) * m_size;
-    if (m_table == nullptr) {
-        throw std::bad_alloc();
-        return;
-    }
-
-    // Inicializa la tabla hash a nullptr
-    for (size_t i = 0; i < m_size; ++i) {
-        m_table[i] = nullptr;
-        g_ciclos++;
-    }
+    m_table = crear_tabla(m_size);
+    redimensionar_entradas(size > 0 ? size : 1);
 }
 
 /**
  * @brief Destructor de Unordered_Map.
- * Libera la memoria de todos los elementos almacenados en la tabla hash.
+ * Libera el índice (y el anterior si había una migración en curso) y el arreglo denso.
  */
-template <typename Key, typename Value>
-Unordered_Map<Key, Value>::~Unordered_Map() 
+template <typename Key, typename Value, typename Hash>
+Unordered_Map<Key, Value, Hash>::~Unordered_Map()
 {
-    for (size_t i = 0; i < m_size; ++i) {
-        key_value_pair* current = m_table[i];
-        while (current != nullptr) {
-            key_value_pair* to_delete = current;
-            current = current->next;
-            g_ciclos++;
-            g_tamano -= sizeof(key_value_pair);
-            delete to_delete;
-        }
-    }
-    g_tamano -= sizeof(key_value_pair*) * m_size;
+    g_tamano -= sizeof(slot) * m_size;
     delete[] m_table;
     m_table = nullptr;
+
+    if (m_anterior != nullptr) {
+        g_tamano -= sizeof(slot) * m_size_anterior;
+        delete[] m_anterior;
+        m_anterior = nullptr;
+    }
+
+    g_tamano -= sizeof(entrada) * m_capacidad;
+    delete[] m_entradas;
+    m_entradas = nullptr;
     std::cout << "Mapa destruido" << std::endl;
 }
 
+/**
+ * @brief Reserva un índice con todas sus casillas vacías.
+ *
+ * @param size Número de casillas.
+ * @return Puntero al nuevo índice.
+ */
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::slot *Unordered_Map<Key, Value, Hash>::crear_tabla(size_t size)
+{
+    slot *tabla = new slot[size];
+    g_tamano += sizeof(slot) * size;
+
+    // Marca todas las casillas como vacías
+    for (size_t i = 0; i < size; ++i) {
+        tabla[i].indice = CASILLA_VACIA;
+        g_ciclos++;
+    }
+    return tabla;
+}
+
+/**
+ * @brief Cambia la capacidad del arreglo denso. Las entradas se copian en orden, así que sus
+ * posiciones (y por tanto el índice) no cambian.
+ *
+ * @param capacidad Nueva capacidad.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::redimensionar_entradas(size_t capacidad)
+{
+    entrada *nuevas = new entrada[capacidad];
+    for (size_t i = 0; i < m_count; ++i, g_ciclos++)
+        nuevas[i] = m_entradas[i];
+
+    g_tamano += sizeof(entrada) * capacidad;
+    g_tamano -= sizeof(entrada) * m_capacidad;
+    delete[] m_entradas;
+    m_entradas = nuevas;
+    m_capacidad = capacidad;
+}
+
 /**
  * @brief Libera la memoria ocupada (si la hay) por los valores de la tabla hash.
  * Es responsabilidad del llamador liberar la memoria ocupada por los valores.
  */
-template <typename Key, typename Value>
-void Unordered_Map<Key, Value>::clear_values() 
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::clear_values()
 {
-    for (size_t i = 0; i < m_size; ++i) {
-        key_value_pair* current = m_table[i];
-        while (current != nullptr) {
-            delete current->value;
-            current->value = nullptr;
-            current = current->next;
-            g_ciclos++;
+    for (size_t i = 0; i < m_count; ++i) {
+        delete m_entradas[i].value;
+        m_entradas[i].value = nullptr;
+        g_ciclos++;
+    }
+}
+
+/**
+ * @brief Vacía el mapa: marca todas las casillas del índice como vacías y descarta el índice
+ * anterior si había una migración en curso. Los valores no se liberan.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::clear()
+{
+    for (size_t i = 0; i < m_size; ++i, g_ciclos++)
+        m_table[i].indice = CASILLA_VACIA;
+
+    if (m_anterior != nullptr) {
+        g_tamano -= sizeof(slot) * m_size_anterior;
+        delete[] m_anterior;
+        m_anterior = nullptr;
+        m_size_anterior = 0;
+        m_count_anterior = 0;
+        m_migracion = 0;
+    }
+    m_count = 0;
+}
+
+/**
+ * @brief Calcula la distancia de sondeo + 1 de una casilla a partir del hash que guarda.
+ */
+template <typename Key, typename Value, typename Hash>
+uint32_t Unordered_Map<Key, Value, Hash>::distancia(size_t index, uint32_t hash, size_t size)
+{
+    return static_cast<uint32_t>(((index - hash) & (size - 1)) + 1);
+}
+
+/**
+ * @brief Busca la casilla de una clave en un índice.
+ *
+ * @return Índice de la casilla, o size si la clave no está.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t Unordered_Map<Key, Value, Hash>::buscar_en(const slot *tabla, size_t size, const Key& key) const
+{
+    return buscar_con_hash(tabla, size, key, hash_fuction(key));
+}
+
+/**
+ * @brief Busca la casilla de una clave a partir de su hash ya calculado. Por la invariante
+ * Robin Hood, la búsqueda termina al encontrar una casilla más cercana a su ideal que la
+ * distancia recorrida. La clave solo se compara si los hashes guardados coinciden.
+ *
+ * @return Índice de la casilla, o size si la clave no está.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t Unordered_Map<Key, Value, Hash>::buscar_con_hash(const slot *tabla, size_t size, const Key& key, size_t hash) const
+{
+    uint32_t h = static_cast<uint32_t>(hash);
+    size_t index = h & (size - 1);
+    uint32_t recorrido = 1;
+
+    while (tabla[index].indice != CASILLA_VACIA && distancia(index, tabla[index].hash, size) >= recorrido) {
+        g_ciclos++;
+        if (tabla[index].hash == h && Hash::equal(m_entradas[tabla[index].indice].key, key))
+            return index;
+        index = (index + 1) & (size - 1);
+        recorrido++;
+    }
+    return size;
+}
+
+/**
+ * @brief Busca la casilla que apunta a una entrada concreta del arreglo denso.
+ *
+ * @return Índice de la casilla, o size si no está en este índice.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t Unordered_Map<Key, Value, Hash>::buscar_indice(const slot *tabla, size_t size, uint32_t hash, uint32_t indice) const
+{
+    size_t index = hash & (size - 1);
+    uint32_t recorrido = 1;
+
+    while (tabla[index].indice != CASILLA_VACIA && distancia(index, tabla[index].hash, size) >= recorrido) {
+        g_ciclos++;
+        if (tabla[index].indice == indice)
+            return index;
+        index = (index + 1) & (size - 1);
+        recorrido++;
+    }
+    return size;
+}
+
+/**
+ * @brief Ubica una casilla en el índice con la política Robin Hood.
+ * Si la casilla que viaja está más lejos de su casilla ideal que la ocupante actual,
+ * intercambian lugares y se continúa ubicando a la desplazada.
+ *
+ * @param entrante Casilla a ubicar.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::ubicar(slot *tabla, size_t size, slot entrante)
+{
+    size_t index = entrante.hash & (size - 1);
+    uint32_t recorrido = 1;
+
+    while (tabla[index].indice != CASILLA_VACIA) {
+        uint32_t ocupante = distancia(index, tabla[index].hash, size);
+        if (ocupante < recorrido) {
+            slot desplazado = tabla[index];
+            tabla[index] = entrante;
+            entrante = desplazado;
+            recorrido = ocupante;
         }
+        index = (index + 1) & (size - 1);
+        recorrido++;
+        g_ciclos++;
+    }
+
+    tabla[index] = entrante;
+}
+
+/**
+ * @brief Vacía una casilla del índice. Las casillas siguientes de la cadena se desplazan una
+ * posición hacia atrás (backward shift), así que no quedan lápidas.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::vaciar_casilla(slot *tabla, size_t size, size_t index)
+{
+    size_t siguiente = (index + 1) & (size - 1);
+
+    // Desplaza hacia atrás las casillas que no están en su posición ideal
+    while (tabla[siguiente].indice != CASILLA_VACIA && distancia(siguiente, tabla[siguiente].hash, size) > 1) {
+        tabla[index] = tabla[siguiente];
+        index = siguiente;
+        siguiente = (siguiente + 1) & (size - 1);
+        g_ciclos++;
     }
+
+    tabla[index].indice = CASILLA_VACIA;
+}
+
+/**
+ * @brief Migra algunas casillas del índice anterior al actual.
+ *
+ * Cada paso mueve una casilla o salta una vacía. Sacar una casilla desplaza hacia atrás
+ * a las que le siguen, por lo que el cursor solo avanza cuando su casilla queda vacía;
+ * si una cadena da la vuelta al final del índice, el cursor vuelve a empezar desde 0.
+ * La migración termina cuando ya no quedan casillas ocupadas en el índice anterior.
+ * Las entradas del arreglo denso no se mueven.
+ *
+ * @param pasos Número máximo de casillas a procesar.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::migrar(size_t pasos)
+{
+    while (m_anterior != nullptr && m_count_anterior > 0 && pasos > 0) {
+        slot casilla = m_anterior[m_migracion];
+        if (casilla.indice != CASILLA_VACIA) {
+            vaciar_casilla(m_anterior, m_size_anterior, m_migracion);
+            m_count_anterior--;
+            ubicar(m_table, m_size, casilla);
+        } else {
+            m_migracion = (m_migracion + 1) & (m_size_anterior - 1);
+        }
+        pasos--;
+        g_ciclos++;
+    }
+
+    if (m_anterior != nullptr && m_count_anterior == 0) {
+        g_tamano -= sizeof(slot) * m_size_anterior;
+        delete[] m_anterior;
+        m_anterior = nullptr;
+        m_size_anterior = 0;
+        m_migracion = 0;
+    }
+}
+
+/**
+ * @brief Inicia el crecimiento: el índice actual pasa a ser el anterior y se crea uno nuevo vacío.
+ * Si ya había una migración en curso, primero se termina.
+ *
+ * @param nuevo_size Número de casillas del nuevo índice.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::crecer(size_t nuevo_size)
+{
+    migrar(SIZE_MAX);
+
+    m_anterior = m_table;
+    m_size_anterior = m_size;
+    m_count_anterior = m_count;
+    m_migracion = 0;
+
+    m_table = crear_tabla(nuevo_size);
+    m_size = nuevo_size;
 }
 
 /**
  * @brief Inserta un nuevo par clave-valor en la tabla hash.
- * Si la clave ya existe, actualiza su valor, si hay colisión, se maneja mediante encadenamiento.
- * 
+ * Si la clave ya existe, actualiza su valor. Si no, la entrada se agrega al final del arreglo
+ * denso y su casilla se ubica en el índice con sondeo lineal Robin Hood.
+ *
  * @param key Clave que se desea insertar.
  * @param value Valor asociado a la clave.
  */
-template <typename Key, typename Value>
-void Unordered_Map<Key, Value>::insert(const Key& key, Value *value)
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::insert(const Key& key, Value *value)
 {
-    size_t index = hash_fuction(key);
-    key_value_pair* current = m_table[index];
+    migrar(PASOS_MIGRACION);
 
-    // Verifica si la clave ya existe
-    while (current != nullptr) {
-        if (current->key == key) {
-            delete current->value; // Libera el valor anterior
-            current->value = value; // Asigna el nuevo valor
-            g_ciclos++;
+    size_t hash = hash_fuction(key);
+
+    // Verifica si la clave ya existe en alguno de los dos índices
+    size_t index = buscar_con_hash(m_table, m_size, key, hash);
+    if (index != m_size) {
+        entrada &actual = m_entradas[m_table[index].indice];
+        delete actual.value; // Libera el valor anterior
+        actual.value = value; // Asigna el nuevo valor
+        return;
+    }
+
+    if (m_anterior != nullptr) {
+        index = buscar_con_hash(m_anterior, m_size_anterior, key, hash);
+        if (index != m_size_anterior) {
+            entrada &actual = m_entradas[m_anterior[index].indice];
+            delete actual.value;
+            actual.value = value;
             return;
         }
-        current = current->next;
-        g_ciclos++;
     }
 
-    // Si no se encontró, agrega un nuevo nodo al principio de la lista
-    key_value_pair* new_pair = new key_value_pair(key, value);
-    g_tamano += sizeof(key_value_pair);
-    new_pair->next = m_table[index];
-    m_table[index] = new_pair;
+    if (m_count + 1 > m_size * CARGA_MAXIMA)
+        crecer(m_size * 2);
+
+    if (m_count == m_capacidad)
+        redimensionar_entradas(m_capacidad * 2);
+
+    m_entradas[m_count].key = key;
+    m_entradas[m_count].value = value;
+
+    slot nuevo;
+    nuevo.hash = static_cast<uint32_t>(hash);
+    nuevo.indice = static_cast<uint32_t>(m_count);
+    ubicar(m_table, m_size, nuevo);
+    m_count++;
 }
 
 /**
  * @brief Busca un valor asociado a una clave en la tabla hash.
- * 
+ *
  * @param key Clave para la cual se desea encontrar el valor.
  * @return Valor asociado a la clave o nullptr si no se encuentra.
  */
-template <typename Key, typename Value>
-Value* Unordered_Map<Key, Value>::find(const Key& key) 
+template <typename Key, typename Value, typename Hash>
+Value* Unordered_Map<Key, Value, Hash>::find(const Key& key)
 {
-    size_t index = hash_fuction(key);
-    key_value_pair* current = m_table[index];
-    
-    while (current != nullptr) {
-        if (current->key == key) {
-            g_ciclos++;
-            return current->value;
-        }
-        current = current->next;
-        g_ciclos++;
+    migrar(PASOS_MIGRACION);
+    return static_cast<const Unordered_Map*>(this)->find(key);
+}
+
+/**
+ * @brief Busca un valor en ambos índices sin avanzar la migración.
+ *
+ * @param key Clave para la cual se desea encontrar el valor.
+ * @return Valor asociado a la clave o nullptr si no se encuentra.
+ */
+template <typename Key, typename Value, typename Hash>
+Value* Unordered_Map<Key, Value, Hash>::find(const Key& key) const
+{
+    size_t hash = hash_fuction(key);
+    size_t index = buscar_con_hash(m_table, m_size, key, hash);
+    if (index != m_size)
+        return m_entradas[m_table[index].indice].value;
+
+    if (m_anterior != nullptr) {
+        index = buscar_con_hash(m_anterior, m_size_anterior, key, hash);
+        if (index != m_size_anterior)
+            return m_entradas[m_anterior[index].indice].value;
     }
-    
+
     return nullptr;
 }
 
+/**
+ * @brief Busca un lote de claves en grupos de LOTE_PREFETCH: primero calcula los hashes y
+ * precarga las casillas ideales de todo el grupo, después recorre las cadenas de sondeo y
+ * precarga las entradas encontradas, y al final lee los valores.
+ * La migración avanza una sola vez por lote.
+ *
+ * @param keys Claves a buscar.
+ * @param n Número de claves.
+ * @param out Valores encontrados (nullptr para las claves ausentes).
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::find_many(const Key* keys, size_t n, Value** out)
+{
+    migrar(PASOS_MIGRACION);
+
+    size_t hashes[LOTE_PREFETCH];
+    uint32_t posiciones[LOTE_PREFETCH];
+
+    for (size_t inicio = 0; inicio < n; inicio += LOTE_PREFETCH) {
+        size_t lote = (n - inicio < LOTE_PREFETCH) ? n - inicio : LOTE_PREFETCH;
+
+        for (size_t i = 0; i < lote; ++i) {
+            hashes[i] = hash_fuction(keys[inicio + i]);
+            __builtin_prefetch(&m_table[hashes[i] & (m_size - 1)]);
+            if (m_anterior != nullptr)
+                __builtin_prefetch(&m_anterior[hashes[i] & (m_size_anterior - 1)]);
+        }
+
+        for (size_t i = 0; i < lote; ++i) {
+            const Key &key = keys[inicio + i];
+            size_t index = buscar_con_hash(m_table, m_size, key, hashes[i]);
+            posiciones[i] = CASILLA_VACIA;
+
+            if (index != m_size) {
+                posiciones[i] = m_table[index].indice;
+            } else if (m_anterior != nullptr) {
+                index = buscar_con_hash(m_anterior, m_size_anterior, key, hashes[i]);
+                if (index != m_size_anterior)
+                    posiciones[i] = m_anterior[index].indice;
+            }
+
+            if (posiciones[i] != CASILLA_VACIA)
+                __builtin_prefetch(&m_entradas[posiciones[i]]);
+        }
+
+        for (size_t i = 0; i < lote; ++i)
+            out[inicio + i] = (posiciones[i] != CASILLA_VACIA) ? m_entradas[posiciones[i]].value : nullptr;
+    }
+}
+
 /**
  * @brief Elimina un par clave-valor de la tabla hash.
- * Si la clave no existe, no realiza ninguna acción.
- * 
+ * Si la clave no existe, no realiza ninguna acción. La última entrada del arreglo denso
+ * ocupa el hueco y su casilla del índice se actualiza.
+ *
  * @param key Clave del elemento que se desea eliminar.
  * @return Un puntero al valor eliminado o nullptr si no se encuentra. Será liberado por el llamador.
  */
- 
-template <typename Key, typename Value>
-Value *Unordered_Map<Key, Value>::erase(const Key& key) 
+
+template <typename Key, typename Value, typename Hash>
+Value *Unordered_Map<Key, Value, Hash>::erase(const Key& key)
 {
-    size_t index = hash_fuction(key);
-    key_value_pair* current = m_table[index];
-    key_value_pair* previous = nullptr;
-    Value *value = nullptr; // Inicializa el puntero a nullptr
-    while (current != nullptr) {
-        g_ciclos++;
-        if (current->key == key) {
-            if (previous == nullptr) {
-                // Si no tiene un elemento anterior, significa que es el primer elemento de la lista
-                m_table[index] = current->next;
-            } else {
-                // Eliminar un elemento intermedio o final
-                previous->next = current->next;
-            }
-            value = current->value; // Guarda el valor antes de eliminar
-            g_tamano -= sizeof(key_value_pair);
-            delete current;
-            return value;
-        }
-        previous = current;
-        current = current->next;
+    migrar(PASOS_MIGRACION);
+
+    size_t hash = hash_fuction(key);
+    uint32_t posicion;
+
+    size_t index = buscar_con_hash(m_table, m_size, key, hash);
+    if (index != m_size) {
+        posicion = m_table[index].indice;
+        vaciar_casilla(m_table, m_size, index);
+    } else {
+        if (m_anterior == nullptr)
+            return nullptr; // Si no se encontró la clave, retorna nullptr
+
+        index = buscar_con_hash(m_anterior, m_size_anterior, key, hash);
+        if (index == m_size_anterior)
+            return nullptr;
+
+        posicion = m_anterior[index].indice;
+        vaciar_casilla(m_anterior, m_size_anterior, index);
+        m_count_anterior--;
+    }
+
+    Value *value = m_entradas[posicion].value; // Guarda el valor antes de eliminar
+    uint32_t ultima = static_cast<uint32_t>(m_count - 1);
+    m_count--;
+
+    if (posicion == ultima)
+        return value;
+
+    // La última entrada pasa al hueco y su casilla se redirige
+    m_entradas[posicion] = m_entradas[ultima];
+    uint32_t h = static_cast<uint32_t>(hash_fuction(m_entradas[posicion].key));
+
+    index = buscar_indice(m_table, m_size, h, ultima);
+    if (index != m_size) {
+        m_table[index].indice = posicion;
+    } else {
+        index = buscar_indice(m_anterior, m_size_anterior, h, ultima);
+        m_anterior[index].indice = posicion;
     }
-    return nullptr; // Si no se encontró la clave, retorna nullptr
+
+    return value;
+}
+
+/**
+ * @brief Garantiza capacidad para n elementos. Si hace falta crecer, la migración se hace
+ * completa en este momento: reserve() se llama antes de cargar, con el mapa casi vacío.
+ *
+ * @param n Número de elementos que se espera almacenar.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::reserve(size_t n)
+{
+    if (n > m_capacidad)
+        redimensionar_entradas(n);
+
+    size_t necesario = potencia_de_dos(RESIZE(n));
+    if (necesario <= m_size)
+        return;
+
+    crecer(necesario);
+    migrar(SIZE_MAX);
 }
 
 /**
-* @brief Función hash que calcula el índice para una clave utilizando el algoritmo djb2.
-* 
-* @param key La clave para la cual se calculará el índice.
-* @return El índice calculado en la tabla hash.
+ * @brief Devuelve el número de elementos almacenados.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t Unordered_Map<Key, Value, Hash>::size() const
+{
+    return m_count;
+}
+
+/**
+* @brief Calcula el valor hash de una clave con la política de hash del mapa.
+*
+* @param key La clave para la cual se calculará el hash.
+* @return El valor hash; cada índice lo reduce con la máscara de su número de casillas.
 */
-template <typename Key, typename Value>
-size_t Unordered_Map<Key, Value>::hash_fuction(const Key& key) const 
+template <typename Key, typename Value, typename Hash>
+size_t Unordered_Map<Key, Value, Hash>::hash_fuction(const Key& key) const
 {
-    size_t hash_value = 5381; ///< Valor inicial del hash (un número primo utilizado como semilla).
+    return Hash::hash(key);
+}
 
-    const uint8_t* key_bytes = reinterpret_cast<const uint8_t*>(&key);
-    for (size_t i = 0; i < sizeof(Key); ++i, g_ciclos++)
-        hash_value = ((hash_value << 5) + hash_value) + key_bytes[i]; // Fórmula djb2: hash * 33 + c
-    
-    return hash_value % m_size; // Retorna el índice en la tabla
+/**
+ * @brief Redondea un número de casillas a la siguiente potencia de dos.
+ *
+ * @param n Número mínimo de casillas.
+ * @return La menor potencia de dos mayor o igual que n.
+ */
+template <typename Key, typename Value, typename Hash>
+size_t Unordered_Map<Key, Value, Hash>::potencia_de_dos(size_t n)
+{
+    size_t potencia = 1;
+    while (potencia < n)
+        potencia <<= 1;
+    return potencia;
 }
 
 /**
  * @brief Obtiene el tamaño de la tabla hash.
- * 
- * @return El tamaño de la tabla hash.
+ *
+ * @return Bytes del objeto, de los índices y del arreglo denso.
  */
-template <typename Key, typename Value>
-
-size_t Unordered_Map<Key, Value>::info_map() const
+template <typename Key, typename Value, typename Hash>
+size_t Unordered_Map<Key, Value, Hash>::info_map() const
 {
-    return sizeof(*this);
+    return sizeof(*this) + sizeof(slot) * (m_size + m_size_anterior) + sizeof(entrada) * m_capacidad;
 }
 
 /**
- * @brief Itera sobre todos los elementos de la tabla hash y aplica una función de callback a cada par clave-valor.
- * 
- * @param callback Función que se aplicará a cada par clave-valor.
- * @param data Datos adicionales que se pasarán a la función de callback.
+ * @brief Calcula las estadísticas recorriendo las casillas de ambos índices.
+ * La distancia de sondeo de cada elemento sale del hash guardado en su casilla.
  */
-template <typename Key, typename Value>
-void Unordered_Map<Key, Value>::for_each(void (*callback)(Key, Value*, void*), void *data) 
+template <typename Key, typename Value, typename Hash>
+Estadisticas_Mapa Unordered_Map<Key, Value, Hash>::estadisticas() const
 {
-    for (size_t i = 0; i < m_size; ++i) {
-        key_value_pair* current = m_table[i];
-        while (current != nullptr) {
-            callback(current->key, current->value, data);
-            current = current->next;
+    Estadisticas_Mapa estadisticas = {};
+    const slot *tablas[2] = {m_table, m_anterior};
+    size_t sizes[2] = {m_size, m_size_anterior};
+
+    for (size_t t = 0; t < 2; ++t) {
+        for (size_t i = 0; tablas[t] != nullptr && i < sizes[t]; ++i) {
+            if (tablas[t][i].indice == CASILLA_VACIA)
+                continue;
+
+            uint32_t sondeo = distancia(i, tablas[t][i].hash, sizes[t]);
+            if (sondeo > estadisticas.sondeo_maximo)
+                estadisticas.sondeo_maximo = sondeo;
+            estadisticas.histograma[(sondeo < HISTOGRAMA_SONDEO ? sondeo : HISTOGRAMA_SONDEO) - 1]++;
             g_ciclos++;
         }
     }
+
+    estadisticas.casillas = m_size + m_size_anterior;
+    estadisticas.ocupadas = m_count;
+    estadisticas.factor_carga = static_cast<double>(m_count) / m_size;
+    estadisticas.migrando = (m_anterior != nullptr);
+    estadisticas.bytes_indice = sizeof(slot) * (m_size + m_size_anterior);
+    estadisticas.bytes_entradas = sizeof(entrada) * m_capacidad;
+    estadisticas.bytes_totales = info_map();
+    return estadisticas;
+}
+
+/**
+ * @brief Imprime las estadísticas con el mismo formato de reporte que imprimir_contadores.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::imprimir_estadisticas(const char *nombre) const
+{
+    imprimir_estadisticas(nombre, estadisticas());
+}
+
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::imprimir_estadisticas(const char *nombre, const Estadisticas_Mapa &e)
+{
+    std::cout << "Para el mapa: " << nombre << " hay " << e.ocupadas << " elementos en "
+              << e.casillas << " casillas (factor de carga " << e.factor_carga << ")"
+              << (e.migrando ? ", con una migración en curso\n" : "\n");
+    std::cout << "Para el mapa: " << nombre << " el sondeo máximo es " << e.sondeo_maximo << "\n";
+    for (size_t i = 0; i < HISTOGRAMA_SONDEO; ++i) {
+        std::cout << "Para el mapa: " << nombre << " hay " << e.histograma[i] << " elementos a distancia "
+                  << (i + 1) << (i + 1 == HISTOGRAMA_SONDEO ? " o más\n" : "\n");
+    }
+    std::cout << "Para el mapa: " << nombre << " se usan " << e.bytes_totales << " bytes ("
+              << e.bytes_indice << " de índice, " << e.bytes_entradas << " de entradas y "
+              << e.bytes_valores << " de valores propios)" << std::endl;
+}
+
+/**
+ * @brief Escribe las estadísticas como un objeto JSON en una sola línea.
+ */
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::estadisticas_json(std::ostream &salida, const char *nombre) const
+{
+    estadisticas_json(salida, nombre, estadisticas());
+}
+
+template <typename Key, typename Value, typename Hash>
+void Unordered_Map<Key, Value, Hash>::estadisticas_json(std::ostream &salida, const char *nombre, const Estadisticas_Mapa &e)
+{
+    salida << "{\"mapa\":\"" << nombre << "\""
+           << ",\"casillas\":" << e.casillas
+           << ",\"ocupadas\":" << e.ocupadas
+           << ",\"factor_carga\":" << e.factor_carga
+           << ",\"sondeo_maximo\":" << e.sondeo_maximo
+           << ",\"histograma_sondeo\":[";
+    for (size_t i = 0; i < HISTOGRAMA_SONDEO; ++i)
+        salida << (i > 0 ? "," : "") << e.histograma[i];
+    salida << "],\"migrando\":" << (e.migrando ? "true" : "false")
+           << ",\"bytes_indice\":" << e.bytes_indice
+           << ",\"bytes_entradas\":" << e.bytes_entradas
+           << ",\"bytes_valores\":" << e.bytes_valores
+           << ",\"bytes_totales\":" << e.bytes_totales << "}";
+}
+
+/**
+ * @brief Recorre linealmente el arreglo denso y aplica una función a cada par clave-valor.
+ *
+ * @param funcion Función que se aplicará a cada par clave-valor. Si devuelve bool, false detiene el recorrido.
+ * @return true si se recorrieron todos los elementos.
+ */
+template <typename Key, typename Value, typename Hash>
+template <typename F>
+bool Unordered_Map<Key, Value, Hash>::for_each(F&& funcion)
+{
+    constexpr bool detenible = std::is_same<typename std::invoke_result<F&, const Key&, Value*>::type, bool>::value;
+
+    for (size_t i = 0; i < m_count; ++i) {
+        g_ciclos++;
+        if constexpr (detenible) {
+            if (!funcion(m_entradas[i].key, m_entradas[i].value))
+                return false;
+        } else {
+            funcion(m_entradas[i].key, m_entradas[i].value);
+        }
+    }
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+Unordered_Map<Key, Value, Hash>::iterator::iterator(entrada *actual)
+    : m_actual(actual) {}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::entrada& Unordered_Map<Key, Value, Hash>::iterator::operator*() const
+{
+    return *m_actual;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::entrada* Unordered_Map<Key, Value, Hash>::iterator::operator->() const
+{
+    return m_actual;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::iterator& Unordered_Map<Key, Value, Hash>::iterator::operator++()
+{
+    m_actual++;
+    g_ciclos++;
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::iterator Unordered_Map<Key, Value, Hash>::iterator::operator++(int)
+{
+    iterator anterior = *this;
+    ++(*this);
+    return anterior;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool Unordered_Map<Key, Value, Hash>::iterator::operator==(const iterator &otro) const
+{
+    return m_actual == otro.m_actual;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool Unordered_Map<Key, Value, Hash>::iterator::operator!=(const iterator &otro) const
+{
+    return !(*this == otro);
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::iterator Unordered_Map<Key, Value, Hash>::begin()
+{
+    return iterator(m_entradas);
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::iterator Unordered_Map<Key, Value, Hash>::end()
+{
+    return iterator(m_entradas + m_count);
+}
+
+template <typename Key, typename Value, typename Hash>
+Unordered_Map<Key, Value, Hash>::const_iterator::const_iterator(const entrada *actual)
+    : m_actual(actual) {}
+
+template <typename Key, typename Value, typename Hash>
+Unordered_Map<Key, Value, Hash>::const_iterator::const_iterator(const iterator &otro)
+    : m_actual(otro.m_actual) {}
+
+template <typename Key, typename Value, typename Hash>
+const typename Unordered_Map<Key, Value, Hash>::entrada& Unordered_Map<Key, Value, Hash>::const_iterator::operator*() const
+{
+    return *m_actual;
+}
+
+template <typename Key, typename Value, typename Hash>
+const typename Unordered_Map<Key, Value, Hash>::entrada* Unordered_Map<Key, Value, Hash>::const_iterator::operator->() const
+{
+    return m_actual;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::const_iterator& Unordered_Map<Key, Value, Hash>::const_iterator::operator++()
+{
+    m_actual++;
+    g_ciclos++;
+    return *this;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::const_iterator Unordered_Map<Key, Value, Hash>::const_iterator::operator++(int)
+{
+    const_iterator anterior = *this;
+    ++(*this);
+    return anterior;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool Unordered_Map<Key, Value, Hash>::const_iterator::operator==(const const_iterator &otro) const
+{
+    return m_actual == otro.m_actual;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool Unordered_Map<Key, Value, Hash>::const_iterator::operator!=(const const_iterator &otro) const
+{
+    return !(*this == otro);
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::const_iterator Unordered_Map<Key, Value, Hash>::begin() const
+{
+    return const_iterator(m_entradas);
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::const_iterator Unordered_Map<Key, Value, Hash>::end() const
+{
+    return const_iterator(m_entradas + m_count);
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::const_iterator Unordered_Map<Key, Value, Hash>::cbegin() const
+{
+    return begin();
+}
+
+template <typename Key, typename Value, typename Hash>
+typename Unordered_Map<Key, Value, Hash>::const_iterator Unordered_Map<Key, Value, Hash>::cend() const
+{
+    return end();
 }
 #endif
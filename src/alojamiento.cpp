@@ -1,8 +1,9 @@
 #include <iostream>
 #include <cstring>
+#include <algorithm>
 #include "alojamiento.hpp"
 #include "reserva.hpp"
-#include "linked_list.hpp"
+#include "intrusive_list.hpp"
 /**
  * @def LOG_ERROR(fn, msg)
  * @brief Macro para imprimir errores con el contexto de Alojamiento.
@@ -23,25 +24,14 @@
 Alojamiento::Alojamiento(uint32_t id, const char* nombre, uint64_t codigo_anfitrion,
                          const char* direccion, const char* departamento,
                          const char* municipio, uint8_t tipo, float precio, 
-                         const char* amenidades)
+                         const char* amenidades, Arena_Cadenas *arena)
 
     : m_id(id), m_codigo_anfitrion(codigo_anfitrion),
-      m_tipo(tipo), m_precio(precio), m_nombre(nullptr), m_direccion(nullptr), 
-      m_departamento(nullptr), m_municipio(nullptr), m_amenidades(nullptr)
+      m_nombre(arena->copiar(nombre)), m_direccion(arena->copiar(direccion)), 
+      m_departamento(arena->copiar(departamento)), m_municipio(arena->copiar(municipio)),
+      m_tipo(tipo), m_reservas_solapadas(false), m_precio(precio), m_amenidades(arena->copiar(amenidades)),
+      m_reservas(Reserva::enlace_alojamiento())
 {
-    size_t len_nombre = strlen(nombre) + 1;
-    size_t len_direccion = strlen(direccion) + 1;
-    size_t len_departamento = strlen(departamento) + 1;
-    size_t len_municipio = strlen(municipio) + 1;
-    size_t len_amenidades = strlen(amenidades) + 1;
-
-    m_nombre = copy_data(nombre, len_nombre);
-    m_direccion = copy_data(direccion, len_direccion);
-    m_departamento = copy_data(departamento, len_departamento);
-    m_municipio = copy_data(municipio, len_municipio);
-    m_amenidades = copy_data(amenidades, len_amenidades);
-    m_reservas = new Linked_List<Reserva*>();
-    g_strlen_cnt += 5;
 }
 
 /**
@@ -54,24 +44,23 @@ uint64_t Alojamiento::get_codigo_anfitrion() const
 {
     return m_codigo_anfitrion;
 }
+void Alojamiento::iniciar_calendario(const Fecha &base)
+{
+    m_calendario.iniciar(base);
+    m_reservas_solapadas = false;
+    for (const Reserva &reserva : m_reservas)
+        marcar_en_calendario(reserva);
+}
+
 /**
- * @brief Copia los datos de una cadena a otra.
- * @param data Cadena de caracteres a copiar.
- * @param len Longitud de la cadena a copiar.
- * @return Puntero a la nueva cadena copiada, o nullptr si hubo error.
+ * @brief Una reserva nueva nunca se cruza con otra porque antes se consulta el calendario; solo
+ *        las que vienen de los archivos pueden hacerlo, y eso se anota para eliminar_reserva.
  */
-char* Alojamiento::copy_data(const char* data, size_t len) 
+void Alojamiento::marcar_en_calendario(const Reserva &reserva)
 {
-    if (data == nullptr)
-        return nullptr;
-
-    char* new_data = new char[len];
-    if (new_data == nullptr)
-        return nullptr;
-
-    memcpy(new_data, data, len);
-    g_memcpy_cnt++;
-    return new_data;
+    if (!m_calendario.libre(reserva.get_fecha_entrada(), reserva.get_fecha_salida()))
+        m_reservas_solapadas = true;
+    m_calendario.marcar(reserva.get_fecha_entrada(), reserva.get_fecha_salida());
 }
 
 /**
@@ -86,7 +75,10 @@ Reserva* Alojamiento::set_reserva(Reserva* reserva)
         return nullptr;
     }
 
-    m_reservas->insert_front(reserva);
+    m_reservas.insert_front(reserva);
+    reserva->set_alojamiento(this);
+    marcar_en_calendario(*reserva);
+    m_indice.invalidar();
     return reserva;
 }
 
@@ -95,17 +87,8 @@ Reserva* Alojamiento::set_reserva(Reserva* reserva)
  */
 void Alojamiento::mostrar_reservas() const
 {
-    if (m_reservas == nullptr) {
-        std::cout << "No hay reservas activas." << std::endl;
-        return;
-    }
-
-    Node<Reserva*>* current = m_reservas->get_head();
-    while (current != nullptr) {
-        Reserva* reserva = current->data;
-        reserva->mostrar();
-        current = m_reservas->get_next(current);
-    }
+    for (const Reserva &reserva : m_reservas)
+        reserva.mostrar();
 }
 
 /**
@@ -120,50 +103,12 @@ void Alojamiento::mostrar_reservas() const
 
 bool Alojamiento::es_candidato_reserva(const Fecha &desde, const Fecha &hasta) const
 {
-    Node<Reserva*>* current = m_reservas->get_head();
-    while (current != nullptr) {
-        Reserva* reserva = current->data;
-        
-        if (*(reserva->get_fecha_entrada()) < hasta && *(reserva->get_fecha_salida()) > desde)
-            return false;
-        
-        current = m_reservas->get_next(current);
-    }
-    
-    return true;
-}
+    if (m_calendario.cubre(desde, hasta))
+        return m_calendario.libre(desde, hasta);
 
-/**
- * @brief Muestra las reservas activas del alojamiento en un rango de fechas y para un departamento en especifico.
- * 
- * Recorre la lista de reservas y muestra la información de cada una
- * que esté dentro del rango de fechas especificado.
- * 
- * @param desde Fecha de inicio.
- * @param hasta Fecha de fin.
- * @param dpto Municipio a filtrar.
- */
-
-bool Alojamiento::es_candidato_reserva(const Fecha &desde, const Fecha &hasta, const std::string &mpo) const
-{
-    Node<Reserva*>* current = m_reservas->get_head();
-    while (current != nullptr) {
-        g_ciclos++;
-        Reserva* reserva = current->data;
-        
-        if (*(reserva->get_fecha_entrada()) < hasta && *(reserva->get_fecha_salida()) > desde)
-            return false;
-        
-        current = m_reservas->get_next(current);
-    }
-
-    if (strcmp(m_municipio, mpo.c_str()) == 0) {
-        g_c_string_cnt++;
-        g_strcmp_cnt++;
-        return true;
-    }
-    
-    return false;
+    return std::none_of(m_reservas.begin(), m_reservas.end(), [&](const Reserva &reserva) {
+        return reserva.get_fecha_entrada() < hasta && reserva.get_fecha_salida() > desde;
+    });
 }
 
 /** 
@@ -174,22 +119,13 @@ bool Alojamiento::es_candidato_reserva(const Fecha &desde, const Fecha &hasta, c
 **/
 void Alojamiento::mostrar_reservas(Fecha &desde, Fecha &hasta) const
 {
-    if (m_reservas == nullptr) {
-        std::cout << "No hay reservas para el alojamiento." << std::endl;
-        return;
-    }
-    
-    Node<Reserva*>* current = m_reservas->get_head();
-    while (current != nullptr) {
-        Reserva* reserva = current->data;
-        
-        if (*(reserva->get_fecha_entrada()) < hasta && *(reserva->get_fecha_salida()) > desde) {
-            std::cout << "Alojamiento: " << m_nombre << std::endl;
-            reserva->mostrar();
-        }
-        
-        current = m_reservas->get_next(current);
-    }
+    if (!m_indice.vigente())
+        m_indice.reconstruir(m_reservas);
+
+    m_indice.for_each_cruce(desde, hasta, [this](const Reserva &reserva) {
+        std::cout << "Alojamiento: " << m_nombre.c_str() << std::endl;
+        reserva.mostrar();
+    });
 }
 /**
  * @brief Muestra la información del alojamiento.
@@ -199,14 +135,14 @@ void Alojamiento::mostrar_alojamiento() const
 {
    std::cout << "------------*------------" << std::endl;
    std::cout << "ID: " << m_id << std::endl;
-   std::cout << "Nombre: " << m_nombre << std::endl;
+   std::cout << "Nombre: " << m_nombre.c_str() << std::endl;
    std::cout << "Código anfitrión: " << m_codigo_anfitrion << std::endl;
-   std::cout << "Dirección: " << m_direccion << std::endl;
-   std::cout << "Departamento: " << m_departamento << std::endl;
-   std::cout << "Municipio: " << m_municipio << std::endl;
+   std::cout << "Dirección: " << m_direccion.c_str() << std::endl;
+   std::cout << "Departamento: " << m_departamento.c_str() << std::endl;
+   std::cout << "Municipio: " << m_municipio.c_str() << std::endl;
    std::cout << "Tipo: " << (m_tipo == 1 ? "Casa" : "Apartamento") << std::endl;
    std::cout << "Precio: " << m_precio << std::endl;
-   std::cout << "Amenidades: " << m_amenidades << std::endl;
+   std::cout << "Amenidades: " << m_amenidades.c_str() << std::endl;
    std::cout << "------------*------------" << std::endl;
 }
 
@@ -224,37 +160,49 @@ float Alojamiento::get_precio() const
 {
     return m_precio;
 }
+
+const Cadena &Alojamiento::get_municipio() const
+{
+    return m_municipio;
+}
 /**
  * @brief Elimina una reserva del alojamiento.
+ * La reserva guarda sus vecinos en la lista, así que sale de ella sin recorrerla.
+ * Sus noches se liberan en el calendario: las estadías son [entrada, salida) y no se cruzan, así
+ * que ninguna otra reserva ocupaba esas noches. Solo si los archivos trajeron reservas que se
+ * cruzan se recorre la lista para volver a marcar las que compartían noches con ella.
  * @return true si se eliminó correctamente, false en caso contrario. 
  */
 
-bool Alojamiento::eliminar_reserva(uint32_t codigo_reserva) 
+bool Alojamiento::eliminar_reserva(Reserva *reserva) 
 {
-    Node<Reserva*>* current = m_reservas->get_head();
-    while (current != nullptr) {
-        g_ciclos++;
-        Reserva* reserva = current->data;
-        if (reserva->get_codigo_reserva() == codigo_reserva) {
-            m_reservas->remove(reserva);
-            return true;
+    g_ciclos++;
+    if (!m_reservas.remove(reserva))
+        return false;
+
+    reserva->set_alojamiento(nullptr);
+    m_indice.invalidar();
+
+    Fecha entrada = reserva->get_fecha_entrada();
+    Fecha salida = reserva->get_fecha_salida();
+    m_calendario.liberar(entrada, salida);
+    if (m_reservas_solapadas) {
+        for (const Reserva &otra : m_reservas) {
+            if (otra.get_fecha_entrada() < salida && otra.get_fecha_salida() > entrada)
+                m_calendario.marcar(otra.get_fecha_entrada(), otra.get_fecha_salida());
         }
-        current = m_reservas->get_next(current);
     }
-    
-    return false;
+    return true;
 }
 
 size_t Alojamiento::get_size() const 
 {
     size_t total_size = sizeof(*this);
-    total_size += strlen(m_nombre) + 1;
-    total_size += strlen(m_direccion) + 1;
-    total_size += strlen(m_departamento) + 1;
-    total_size += strlen(m_municipio) + 1;
-    total_size += strlen(m_amenidades) + 1;
-    total_size += sizeof(Linked_List<Reserva*>);
-    g_strlen_cnt += 5;
+    total_size += m_nombre.size() + 1;
+    total_size += m_direccion.size() + 1;
+    total_size += m_departamento.size() + 1;
+    total_size += m_municipio.size() + 1;
+    total_size += m_amenidades.size() + 1;
     return total_size;
 }
 
@@ -262,10 +210,4 @@ size_t Alojamiento::get_size() const
 Alojamiento::~Alojamiento() 
 {
     g_tamano -= this->get_size();
-    delete[] m_nombre;
-    delete[] m_direccion;
-    delete[] m_departamento;
-    delete[] m_municipio;
-    delete[] m_amenidades;
-    delete m_reservas;
 }
@@ -37,8 +37,7 @@
      : m_documento(documento),  
        m_antiguedad(antiguedad), 
        m_puntuacion(puntuacion),
-       m_password(nullptr),
-       m_alojamientos(nullptr)
+       m_password(nullptr)
  {
         if (password == nullptr) {
             LOG_ERROR("Anfitrion", "La contraseña es nula");
@@ -53,7 +52,6 @@
         }
         memcpy(m_password, password, len);
         m_password[len - 1] = '\0';
-        m_alojamientos = new Linked_List<Alojamiento*>();
         g_strlen_cnt++; // Contador de strlen
         g_memcpy_cnt++; // Contador de memcpy
  };
@@ -112,6 +110,7 @@
  { 
     size_t total_size = sizeof(*this); 
     total_size += strlen(m_password) + 1;
+    total_size += m_alojamientos.get_bytes();
     g_strlen_cnt++; // Contador de strlen
     return total_size;
  }
@@ -130,7 +129,7 @@ Alojamiento* Anfitrion::set_alojamiento(Alojamiento* alojamiento)
         return nullptr;
     }
 
-    m_alojamientos->insert_front(alojamiento);
+    m_alojamientos.push_back(alojamiento);
     return alojamiento;
 }
 
@@ -146,22 +145,16 @@ bool Anfitrion::eliminar_reserva(Reserva* reserva)
         LOG_ERROR("eliminar_reserva", "La reserva es nula");
         return false;
     }
-    uint32_t codigo_alojamiento = reserva->get_codigo_alojamiento();
-    Node<Alojamiento*>* current = m_alojamientos->get_head();
+    //La reserva conoce su alojamiento, así que no hace falta recorrer los del anfitrión
+    Alojamiento* alojamiento = reserva->get_alojamiento();
+    g_ciclos++;
 
-    while (current != nullptr) {
-        g_ciclos++;
-        Alojamiento* alojamiento = current->data;
-        if (alojamiento->get_id() == codigo_alojamiento) {
-            if (alojamiento->eliminar_reserva(reserva->get_codigo_reserva())) {
-                LOG_SUCCESS("eliminar_reserva", "Reserva eliminada con éxito");
-            } else {
-                LOG_ERROR("eliminar_reserva", "No se pudo eliminar la reserva");
-            }
-            reserva = nullptr;
-            break;
+    if (alojamiento != nullptr && alojamiento->get_codigo_anfitrion() == m_documento) {
+        if (alojamiento->eliminar_reserva(reserva)) {
+            LOG_SUCCESS("eliminar_reserva", "Reserva eliminada con éxito");
+        } else {
+            LOG_ERROR("eliminar_reserva", "No se pudo eliminar la reserva");
         }
-        current = m_alojamientos->get_next(current);
     }
     return true;
 }
@@ -175,17 +168,14 @@ bool Anfitrion::eliminar_reserva(Reserva* reserva)
  */
 void Anfitrion::mostrar_alojamientos(Fecha &desde, Fecha &hasta) const
 {
-    if (m_alojamientos == nullptr) {
+    if (m_alojamientos.is_empty()) {
         std::cout << "No hay alojamientos disponibles." << std::endl;
         return;
     }
 
-    Node<Alojamiento*>* current = m_alojamientos->get_head();
-    while (current != nullptr) {
-        Alojamiento* alojamiento = current->data;
+    for (Alojamiento* alojamiento : m_alojamientos) {
         alojamiento->mostrar_reservas(desde, hasta);
         std::cout << "------------------------" << std::endl;
-        current = m_alojamientos->get_next(current);
         g_ciclos++;
     }
 }
@@ -200,8 +190,6 @@ Anfitrion::~Anfitrion()
 {
     g_tamano -= this->get_obj_size();
     delete[] m_password;
-    delete m_alojamientos;
-    m_alojamientos = nullptr;
     m_password = nullptr;
 }
  
\ No newline at end of file
@@ -8,24 +8,6 @@
 
 #include "app.hpp"
 #include "performance.hpp"
-/** Variables globales para medir ciclos y tamaño de objetos en memoria */
-uint32_t g_ciclos = 0; ///< Contador de ciclos
-uint32_t g_tamano = 0; ///< Tamaño total de objetos en memoria
-uint32_t g_strlen_cnt = 0; ///< Contador de strlen
-uint32_t g_memcpy_cnt = 0; ///< Contador de memcpy
-uint32_t g_memcmp_cnt = 0; ///< Contador de memcmp
-uint32_t g_is_digit_cnt = 0; ///< Contador de isdigit
-uint32_t g_getline_cnt = 0; ///< Contador de getline
-uint32_t g_string_find_cnt = 0; ///< Contador de string::find
-uint32_t g_string_substr_cnt = 0; ///< Contador de string::substr
-uint32_t g_std_n_pos_cnt = 0; ///< Contador de std::npos
-uint32_t g_c_string_cnt = 0; ///< Contador de c_str
-uint32_t g_stoi_cnt = 0; ///< Contador de stoi
-uint32_t g_stof_cnt = 0; ///< Contador de stof
-uint32_t g_stoull_cnt = 0; ///< Contador de stoull
-uint32_t g_strcmp_cnt = 0; ///< Contador de memcmp
-uint32_t g_sprintf_cnt = 0; ///< Contador de sprintf
-uint32_t g_string_legnth_cnt = 0; ///< Contador de string::length
 
 /**
  * @brief Esta función hace las llamadas necesarias a las funciones, métodos, para anular una reservación
@@ -35,19 +17,17 @@ uint32_t g_string_legnth_cnt = 0; ///< Contador de string::length
  * @param num_reservas referencia al número de reservas
  * @param update_reservas referencia a una variable booleana que controla si se debe actualizar o no una reserva
  */
-void opcion_anular_reservacion_anfitrion(Unordered_Map<uint32_t, Reserva> *Reservas, 
+void opcion_anular_reservacion_anfitrion(Mapa_Reservas *Reservas, 
                                         Anfitrion *anfitrion_user, size_t &num_reservas,
                                         bool &update_reservas);
 /**
  * @brief función que presenta el menú para eliminar una reservación de un huesped
  * Llama a todos los métodos de las clases involucradas para eliminar la reservación
- * @param Alojamientos mapa con punteros a los alojamientso
  * @param Reservas mapa con punteros a los mapas
  * @param huesped_user Puntero del usuario que va a eliminar su reservación
  */
 
-void opcion_anular_reservacion_huesped(Unordered_Map<uint32_t, Alojamiento> *Alojamientos,
-                                Unordered_Map<uint32_t, Reserva> *Reservas,
+void opcion_anular_reservacion_huesped(Mapa_Reservas *Reservas,
                                 Huesped *huesped_user, size_t &num_reservas,
                                 bool &update_reservas);
 
@@ -63,9 +43,10 @@ void get_int_16(uint16_t &numero);
  * 
  * @param reservas Mapa a las reservas.
  * @param num_reservas Número de reservas en el arreglo.
+ * @param tabla Tabla por columnas de las reservas.
  * @param historico_file Ruta del archivo donde se guardará el histórico.
  */
-static bool crear_historico_reservas(Unordered_Map<uint32_t, Reserva>* Reservas, 
+static bool crear_historico_reservas(Mapa_Reservas* Reservas, Tabla_Reservas *tabla,
                                     const char* filename, Anfitrion* anfitrion, 
                                     Fecha *fecha_sistema, size_t &num_reservas);
 
@@ -127,11 +108,14 @@ static uint32_t dividir_linea(const std::string &linea, std::string *campos, uin
  * @param fecha_salida Fecha de salida.
  * @param huesped Huésped que realiza la reserva.
  * @param sistema Fecha del sistema.
+ * @param Reservas Mapa de reservas donde se construye la nueva reserva.
+ * @param arena Arena donde se guardan las anotaciones de la reserva.
  * @return Reserva* Puntero a la nueva reserva creada.
  */
 
 Reserva *agregar_reserva(Alojamiento *aloj, uint32_t codigo_reserva, uint16_t duracion, 
-    Fecha *fecha_entrada, Fecha *fecha_salida, Huesped *huesped, Fecha *sistema);
+    const Fecha &fecha_entrada, const Fecha &fecha_salida, Huesped *huesped, Fecha *sistema,
+    Mapa_Reservas *Reservas, Arena_Cadenas *arena);
 
 /**
  * @brief Lee el archivo de alojamientos y carga los alojamientos correspondientes a un anfitrion
@@ -142,9 +126,9 @@ Reserva *agregar_reserva(Alojamiento *aloj, uint32_t codigo_reserva, uint16_t du
  * @param codigo_reserva Referencia a una variable donde se guardará el ultimo codigo de reserva
  * @return Mapa hash que contiene los alojamientos leídos.
  */
-static Unordered_Map<uint32_t, Reserva> *leer_reservas(const char* filename, 
-                                        Unordered_Map<uint32_t, Alojamiento>*alojamientos,
-                                        Huesped *huesped,
+static Mapa_Reservas *leer_reservas(const char* filename, 
+                                        Mapa_Alojamientos*alojamientos,
+                                        Huesped *huesped, Tabla_Reservas *tabla, Arena_Cadenas *arena,
                                         size_t &num_reservas, uint32_t &codigo_reserva);
 
 
@@ -197,6 +181,41 @@ void imprimir_contadores(const char* nombre_funcionalidad) {
     g_string_legnth_cnt = 0;
 }
 
+/**
+ * @brief Reporta el estado de los mapas cargados junto a los contadores de la funcionalidad.
+ * Si se compila con ESTADISTICAS_JSON, además vuelca las estadísticas en ESTADISTICAS_FILE.
+ *
+ * @param anfitriones Mapa de anfitriones (puede ser nullptr).
+ * @param alojamientos Mapa de alojamientos.
+ * @param reservas Mapa de reservas.
+ */
+static void imprimir_estadisticas_mapas(Mapa_Anfitriones *anfitriones, Mapa_Alojamientos *alojamientos,
+                                        Mapa_Reservas *reservas)
+{
+    if (anfitriones != nullptr)
+        anfitriones->imprimir_estadisticas("Anfitriones");
+    alojamientos->imprimir_estadisticas("Alojamientos");
+    reservas->imprimir_estadisticas("Reservas");
+
+#ifdef ESTADISTICAS_JSON
+    std::ofstream archivo(ESTADISTICAS_FILE);
+    if (!archivo.is_open()) {
+        std::cerr << "Error al abrir el archivo: " << ESTADISTICAS_FILE << std::endl;
+        return;
+    }
+
+    archivo << "[";
+    if (anfitriones != nullptr) {
+        anfitriones->estadisticas_json(archivo, "Anfitriones");
+        archivo << ",";
+    }
+    alojamientos->estadisticas_json(archivo, "Alojamientos");
+    archivo << ",";
+    reservas->estadisticas_json(archivo, "Reservas");
+    archivo << "]" << std::endl;
+#endif
+}
+
 
 static void obtener_fecha_actual(char* buffer, size_t buffer_size) 
 {
@@ -320,11 +339,12 @@ static uint32_t dividir_linea(const std::string &linea, std::string *campos, uin
  * @param filename Ruta al archivo de texto.
  * @param num_reservas Referencia a una variable donde se guardará la cantidad de alojamientos leidos
  * @param id_anfitrion ID del anfitrion para seleccionar sus alojamientos.
+ * @param arena Arena donde se guardan los textos de los alojamientos.
  * @return Mapa hash que contiene las reservas leídas.
 */
 
-static Unordered_Map<uint32_t, Alojamiento>* leer_alojamientos(const char* filename, 
-                                                                Anfitrion *anfitrion)
+static Mapa_Alojamientos* leer_alojamientos(const char* filename, 
+                                                                Anfitrion *anfitrion, Arena_Cadenas *arena)
 {
     std::ifstream archivo(filename);
     if (!archivo.is_open()) {
@@ -345,7 +365,7 @@ static Unordered_Map<uint32_t, Alojamiento>* leer_alojamientos(const char* filen
         return nullptr;
     }
 
-    Unordered_Map<uint32_t, Alojamiento>*Alojamientos = new Unordered_Map<uint32_t, Alojamiento>(num_alojamientos);
+    Mapa_Alojamientos*Alojamientos = new Mapa_Alojamientos(num_alojamientos);
     num_alojamientos = 0;
 
     if (Alojamientos == nullptr) {
@@ -379,10 +399,10 @@ static Unordered_Map<uint32_t, Alojamiento>* leer_alojamientos(const char* filen
             g_stoi_cnt += 2;
             g_stoull_cnt++;
             if (documento_anfitrion == anfitrion_doc) {
-                Alojamiento *alojamiento = new Alojamiento(codigo_alojamiento, nombre, documento_anfitrion,
-                                                          direccion, departamento, municipio, tipo, precio, amenidades);
+                Alojamiento *alojamiento = Alojamientos->emplace(codigo_alojamiento, codigo_alojamiento, nombre,
+                                                          documento_anfitrion, direccion, departamento,
+                                                          municipio, tipo, precio, amenidades, arena);
                 g_tamano += alojamiento->get_size();
-                Alojamientos->insert(codigo_alojamiento, alojamiento);
                 anfitrion->set_alojamiento(alojamiento);
             }
         } catch (const std::exception& e) {
@@ -401,11 +421,12 @@ static Unordered_Map<uint32_t, Alojamiento>* leer_alojamientos(const char* filen
  * @param filename Ruta al archivo de texto.
  * @param num_reservas Referencia a una variable donde se guardará la cantidad de alojamientos leidos
  * @param anfitriones Mapa hash de anfitriones.
+ * @param arena Arena donde se guardan los textos de los alojamientos.
  * @return Mapa hash que contiene las reservas leídas.
 */
 
-static Unordered_Map<uint32_t, Alojamiento>* cargar_alojamientos_completos(const char* filename, Unordered_Map<uint64_t, Anfitrion>* anfitriones, 
-                                                                            size_t &num_alojamientos)
+static Mapa_Alojamientos* cargar_alojamientos_completos(const char* filename, Mapa_Anfitriones* anfitriones, 
+                                                                            Arena_Cadenas *arena, size_t &num_alojamientos)
 {
     std::ifstream archivo(filename);
     if (!archivo.is_open()) {
@@ -424,7 +445,7 @@ static Unordered_Map<uint32_t, Alojamiento>* cargar_alojamientos_completos(const
         return nullptr;
     }
 
-    Unordered_Map<uint32_t, Alojamiento>*Alojamientos = new Unordered_Map<uint32_t, Alojamiento>(num_alojamientos);
+    Mapa_Alojamientos*Alojamientos = new Mapa_Alojamientos(num_alojamientos);
     num_alojamientos = 0;
 
     if (Alojamientos == nullptr) {
@@ -455,9 +476,9 @@ static Unordered_Map<uint32_t, Alojamiento>* cargar_alojamientos_completos(const
             const char* amenidades = campos[8].c_str();
             Anfitrion* anfitrion = anfitriones->find(documento_anfitrion);
             if (anfitrion != nullptr) {
-                Alojamiento *alojamiento = new Alojamiento(codigo_alojamiento, nombre, documento_anfitrion,
-                                                          direccion, departamento, municipio, tipo, precio, amenidades);
-                Alojamientos->insert(codigo_alojamiento, alojamiento);
+                Alojamiento *alojamiento = Alojamientos->emplace(codigo_alojamiento, codigo_alojamiento, nombre,
+                                                          documento_anfitrion, direccion, departamento,
+                                                          municipio, tipo, precio, amenidades, arena);
                 anfitrion->set_alojamiento(alojamiento);
                 num_alojamientos++;
                 g_tamano += alojamiento->get_size();
@@ -474,18 +495,43 @@ static Unordered_Map<uint32_t, Alojamiento>* cargar_alojamientos_completos(const
     archivo.close();
     return Alojamientos;
 }
+/**
+ * @brief Asigna un lote de reservas a sus alojamientos con una sola búsqueda por lotes.
+ *
+ * @param alojamientos Mapa hash de alojamientos.
+ * @param lote Reservas pendientes de asignar.
+ * @param n Número de reservas del lote.
+ */
+static void asignar_reservas(Mapa_Alojamientos *alojamientos, Reserva **lote, size_t n)
+{
+    uint32_t codigos[LOTE_BUSQUEDAS];
+    Alojamiento *destinos[LOTE_BUSQUEDAS];
+
+    for (size_t i = 0; i < n; ++i, g_ciclos++)
+        codigos[i] = lote[i]->get_codigo_alojamiento();
+
+    alojamientos->find_many(codigos, n, destinos);
+
+    for (size_t i = 0; i < n; ++i, g_ciclos++) {
+        if (destinos[i] != nullptr)
+            destinos[i]->set_reserva(lote[i]);
+    }
+}
+
 /**
  * @brief Lee el archivo de reservas y carga las reservas para cada alojamiento
  * 
  * @param filename Ruta al archivo de texto.
  * @param alojamientos Mapa hash de alojamientos.
+ * @param tabla Tabla por columnas donde también se agregan las reservas, o nullptr.
+ * @param arena Arena donde se guardan las anotaciones.
  * @param num_reservas Referencia a una variable donde se guardará la cantidad de reservas leidas
  * @return Mapa hash que contiene las reservas leídas.
 */
 
-static Unordered_Map<uint32_t, Reserva> *leer_reservas(const char* filename, 
-                                        Unordered_Map<uint32_t, Alojamiento>*alojamientos,
-                                        Huesped *huesped,
+static Mapa_Reservas *leer_reservas(const char* filename, 
+                                        Mapa_Alojamientos*alojamientos,
+                                        Huesped *huesped, Tabla_Reservas *tabla, Arena_Cadenas *arena,
                                         size_t &num_reservas, uint32_t &codigo_reserva)
 {
     size_t ciclos_cnt;
@@ -503,74 +549,105 @@ static Unordered_Map<uint32_t, Reserva> *leer_reservas(const char* filename,
     archivo.close();
     archivo.open(filename);
 
-    if (num_reservas == 0) {
-        Unordered_Map<uint32_t, Reserva>* reservas = new Unordered_Map<uint32_t, Reserva>(DEFAULT_NUMERO_RESERVAS);
-        return reservas;
-    }
-
-    Unordered_Map<uint32_t, Reserva>* reservas = new Unordered_Map<uint32_t, Reserva>(num_reservas);
-    Alojamiento *alojamiento = nullptr;
+    Mapa_Reservas* reservas = new Mapa_Reservas(DEFAULT_NUMERO_RESERVAS);
+    Reserva *pendientes[LOTE_BUSQUEDAS];
+    size_t num_pendientes = 0;
 
     if (reservas == nullptr) {
         std::cerr << "Error al asignar memoria para las reservas." << std::endl;
         return nullptr;
     }
-    std::string campos[CAMPOS_MAX_RESERVA];
 
-    for (size_t reserva = 0; std::getline(archivo, linea); reserva++, g_ciclos++, g_getline_cnt++) {
-        uint8_t campos_extraidos = dividir_linea(linea, campos, CAMPOS_MAX_RESERVA);
-    
-        if (campos_extraidos < CAMPOS_MAX_RESERVA) {
-            continue;
-        }
+    if (num_reservas == 0)
+        return reservas;
 
-        //Ahora se puede usar el arreglo campos para crear la reserva
-        //Usamos un try-catch para manejar errores de conversión
-        //y evitar que el programa se detenga
-        try {
-            const char *fecha_inicio = campos[0].c_str();
-            uint16_t duracion = static_cast<uint16_t>(std::stoi(campos[1]));
-            uint32_t codigo_reserva = static_cast<uint32_t>(std::stoi(campos[2]));
-            uint32_t codigo_alojamiento = static_cast<uint32_t>(std::stoi(campos[3]));
-            uint64_t documento_huesped = static_cast<uint64_t>(std::stoull(campos[4]));
-            const char metodo_pago = campos[5][0];
-            const char *fecha_pago = campos[6].c_str();
-            float monto = std::stof(campos[7]);
-            const char *anotaciones = campos[8].c_str();
-
-            Fecha *fecha_inicio_obj = new Fecha();
-            fecha_inicio_obj->cargar_desde_cadena(fecha_inicio);
-            Fecha *fecha_pago_obj = new Fecha();
-            fecha_pago_obj->cargar_desde_cadena(fecha_pago);
-            Fecha *fecha_final_obj = fecha_inicio_obj->sumar_noches(duracion);
-            g_c_string_cnt += 3;
-            g_stoi_cnt += 3;
-            g_stoull_cnt++;
-            g_stof_cnt++;
-            Reserva *reserva = new Reserva(fecha_inicio_obj, fecha_final_obj, duracion, codigo_reserva,
-                                            codigo_alojamiento, documento_huesped, metodo_pago,
-                                            fecha_pago_obj, monto, anotaciones);
-            g_tamano += reserva->get_size();
-            reservas->insert(codigo_reserva, reserva);
-            if (alojamientos != nullptr) {
-                alojamiento = alojamientos->find(reserva->get_codigo_alojamiento());
-            }
-                
-            if (alojamiento != nullptr)
-                alojamiento->set_reserva(reserva);
+    //El mapa crece solo a medida que se agregan reservas, pero al cargar ya se conoce el total
+    reservas->reserve(num_reservas);
+    if (tabla != nullptr)
+        tabla->reserve(num_reservas);
+    //Las líneas se leen por lotes para validar juntas todas sus fechas en una sola llamada
+    std::string lineas[LINEAS_LOTE_RESERVAS];
+    std::string campos[LINEAS_LOTE_RESERVAS][CAMPOS_MAX_RESERVA];
+    bool completa[LINEAS_LOTE_RESERVAS];
+    const char *cadenas_fechas[2 * LINEAS_LOTE_RESERVAS];
+    Fecha fechas_obj[2 * LINEAS_LOTE_RESERVAS];
+    bool fin_archivo = false;
+
+    while (!fin_archivo) {
+        uint32_t num_lineas = 0;
+        while (num_lineas < LINEAS_LOTE_RESERVAS && std::getline(archivo, lineas[num_lineas])) {
+            g_ciclos++;
+            g_getline_cnt++;
+            uint8_t campos_extraidos = dividir_linea(lineas[num_lineas], campos[num_lineas], CAMPOS_MAX_RESERVA);
+            completa[num_lineas] = campos_extraidos >= CAMPOS_MAX_RESERVA;
+            num_lineas++;
+        }
+        fin_archivo = num_lineas < LINEAS_LOTE_RESERVAS;
+
+        //Fechas de entrada en la primera mitad y de pago en la segunda; las líneas incompletas
+        //aportan cadenas vacías, que cargar_lote descarta
+        for (uint32_t i = 0; i < num_lineas; ++i, g_ciclos++) {
+            cadenas_fechas[i] = completa[i] ? campos[i][0].c_str() : "";
+            cadenas_fechas[num_lineas + i] = completa[i] ? campos[i][6].c_str() : "";
+            fechas_obj[i] = Fecha();
+            fechas_obj[num_lineas + i] = Fecha();
+        }
+        Fecha::cargar_lote(cadenas_fechas, fechas_obj, 2 * num_lineas);
+
+        for (uint32_t i = 0; i < num_lineas; ++i) {
+            if (!completa[i])
+                continue;
+
+            //Ahora se puede usar el arreglo campos para crear la reserva
+            //Usamos un try-catch para manejar errores de conversión
+            //y evitar que el programa se detenga
+            try {
+                uint16_t duracion = static_cast<uint16_t>(std::stoi(campos[i][1]));
+                uint32_t codigo_reserva = static_cast<uint32_t>(std::stoi(campos[i][2]));
+                uint32_t codigo_alojamiento = static_cast<uint32_t>(std::stoi(campos[i][3]));
+                uint64_t documento_huesped = static_cast<uint64_t>(std::stoull(campos[i][4]));
+                const char metodo_pago = campos[i][5][0];
+                float monto = std::stof(campos[i][7]);
+                const char *anotaciones = campos[i][8].c_str();
+
+                const Fecha &fecha_inicio_obj = fechas_obj[i];
+                const Fecha &fecha_pago_obj = fechas_obj[num_lineas + i];
+                Fecha fecha_final_obj = fecha_inicio_obj.sumar_noches(duracion);
+                g_c_string_cnt += 3;
+                g_stoi_cnt += 3;
+                g_stoull_cnt++;
+                g_stof_cnt++;
+                Reserva *reserva = reservas->emplace(codigo_reserva, fecha_inicio_obj, fecha_final_obj, duracion,
+                                                codigo_reserva, codigo_alojamiento, documento_huesped,
+                                                metodo_pago, fecha_pago_obj, monto, anotaciones, arena);
+                g_tamano += reserva->get_size();
+                if (tabla != nullptr)
+                    tabla->agregar(reserva);
+                //Las reservas se asignan a sus alojamientos por lotes
+                if (alojamientos != nullptr) {
+                    pendientes[num_pendientes++] = reserva;
+                    if (num_pendientes == LOTE_BUSQUEDAS) {
+                        asignar_reservas(alojamientos, pendientes, num_pendientes);
+                        num_pendientes = 0;
+                    }
+                }
 
-            if (huesped != nullptr) {
-                if (reserva->get_documento_huesped() == (huesped)->get_documento()) {
-                    (huesped)->set_reserva(reserva);
+                if (huesped != nullptr) {
+                    if (reserva->get_documento_huesped() == (huesped)->get_documento()) {
+                        (huesped)->set_reserva(reserva);
+                    }
                 }
-            }
 
-        } catch (const std::exception& e) {
-            std::cerr << "Error al convertir campos en línea: " << linea << std::endl;
-            continue;
+            } catch (const std::exception& e) {
+                std::cerr << "Error al convertir campos en línea: " << lineas[i] << std::endl;
+                continue;
+            }
         }
     }
 
+    if (num_pendientes > 0)
+        asignar_reservas(alojamientos, pendientes, num_pendientes);
+
     archivo.close();
     return reservas;
 }
@@ -684,7 +761,7 @@ static Anfitrion * buscar_anfitrion(const char *anfitrion_file, uint64_t documen
  * @param password Contraseña del anfitrion a buscar.
  * @return true si el anfitrion fue encontrado, false en caso contrario.
  */
-static Unordered_Map<uint64_t, Anfitrion> *cargar_anfitriones(const char *anfitrion_file)
+static Mapa_Anfitriones *cargar_anfitriones(const char *anfitrion_file)
 {
     bool encontrado = false;
     uint64_t doc;
@@ -701,12 +778,11 @@ static Unordered_Map<uint64_t, Anfitrion> *cargar_anfitriones(const char *anfitr
     size_t size = 0;
     archivo >> size;
 
-    Unordered_Map<uint64_t, Anfitrion>* anfitriones = new Unordered_Map<uint64_t, Anfitrion>(RESERVAS_SIZE(size));
+    Mapa_Anfitriones* anfitriones = new Mapa_Anfitriones(RESERVAS_SIZE(size));
     
     while (archivo >> doc >> pass >> antiguedad >> puntuacion) {
         size_t len = strlen(pass) + 1;
-        Anfitrion *anfitrion = new Anfitrion(doc, pass, antiguedad, puntuacion);
-        anfitriones->insert(doc, anfitrion);
+        Anfitrion *anfitrion = anfitriones->emplace(doc, doc, pass, antiguedad, puntuacion);
         g_tamano += anfitrion->get_obj_size();
         g_strlen_cnt++;
         g_ciclos++;
@@ -764,6 +840,46 @@ static bool iniciar_sesion_anfitrion(Anfitrion **anfitrion_user)
     return true;
 }
 
+/**
+ * @brief Escribe una reserva en un archivo.
+ *
+ * Los campos se formatean directamente en el buffer del escritor, sin pasar por el flujo.
+ * 
+ * @param escritor Escritor del archivo donde se escribirá la reserva.
+ * @param reserva Reserva a escribir.
+ */
+static void escribir_reserva(Escritor_Lineas &escritor, Reserva* reserva)
+{
+    if (reserva == nullptr)
+        return;
+
+    char *inicio = escritor.reservar(LONG_CAMPOS_RESERVA);
+    char *destino = reserva->get_fecha_entrada().a_cadena(inicio) + LONG_FECHA_CADENA;
+    *destino++ = ';';
+    destino = formato_entero(destino, reserva->get_duracion());
+    *destino++ = ';';
+    destino = formato_entero(destino, reserva->get_codigo_reserva());
+    *destino++ = ';';
+    destino = formato_entero(destino, reserva->get_codigo_alojamiento());
+    *destino++ = ';';
+    destino = formato_entero(destino, reserva->get_documento_huesped());
+    *destino++ = ';';
+    *destino++ = reserva->get_metodo_pago();
+    *destino++ = ';';
+    destino = reserva->get_fecha_pago().a_cadena(destino) + LONG_FECHA_CADENA;
+    *destino++ = ';';
+    destino = formato_flotante(destino, reserva->get_monto());
+    *destino++ = ';';
+    escritor.confirmar(destino);
+
+    const char *anotaciones = reserva->get_anotaciones();
+    if (anotaciones != nullptr) {
+        escritor.escribir(anotaciones, std::strlen(anotaciones));
+        g_strlen_cnt++;
+    }
+    escritor.escribir('\n');
+}
+
 static void escribir_cancelaciones(Reserva *reserva, const char *filename)
 {
     std::ofstream archivo(filename, std::ios::app);
@@ -772,48 +888,11 @@ static void escribir_cancelaciones(Reserva *reserva, const char *filename)
         return;
     }
 
-    char buffer[LONG_FECHA_CADENA + 1] = {0};
-    reserva->get_fecha_entrada()->a_cadena(buffer);
-    archivo << buffer << ";";
-    archivo << reserva->get_duracion() << ";";
-    archivo << reserva->get_codigo_reserva() << ";";
-    archivo << reserva->get_codigo_alojamiento() << ";";
-    archivo << reserva->get_documento_huesped() << ";";
-    archivo << reserva->get_metodo_pago() << ";";
-    reserva->get_fecha_pago()->a_cadena(buffer);
-    archivo << buffer << ";";
-    archivo << reserva->get_monto() << ";";
-    archivo << (reserva->get_anotaciones() ? reserva->get_anotaciones() : "") << "\n";
-
+    Escritor_Lineas escritor(archivo);
+    escribir_reserva(escritor, reserva);
+    escritor.vaciar();
     archivo.close();
 }
-/**
- * @brief Callback para escribir una reserva en un archivo.
- * 
- * @param codigo_reserva Código de la reserva.
- * @param reserva Reserva a escribir.
- * @param archivo Puntero al archivo donde se escribirá la reserva.
- */
-static void escribir_reserva_callback(uint32_t codigo_reserva, Reserva* reserva, void* archivo_void)
-{
-    if (reserva != nullptr) {
-        std::ofstream& archivo = *reinterpret_cast<std::ofstream*>(archivo_void);
-        char buffer[LONG_FECHA_CADENA + 1] = {0};
-
-        reserva->get_fecha_entrada()->a_cadena(buffer);
-        archivo << buffer << ";";
-        archivo << reserva->get_duracion() << ";";
-        archivo << reserva->get_codigo_reserva() << ";";
-        archivo << reserva->get_codigo_alojamiento() << ";";
-        archivo << reserva->get_documento_huesped() << ";";
-        archivo << reserva->get_metodo_pago() << ";";
-
-        reserva->get_fecha_pago()->a_cadena(buffer);
-        archivo << buffer << ";";
-        archivo << reserva->get_monto() << ";";
-        archivo << (reserva->get_anotaciones() ? reserva->get_anotaciones() : "") << "\n";
-    }
-}
 
 /**
  * @brief Implemente la funcionalidad de cambiar la fecha del sistema
@@ -846,7 +925,7 @@ void opcion_cambiar_fecha(Fecha *fecha_actual)
  * @param num_reservas Número de reservas a escribir.
  * @param codigo_reserva Código de la reserva.
  */
-static void escribir_reservas(Unordered_Map<uint32_t, Reserva>* reservas, const char* filename,
+static void escribir_reservas(Mapa_Reservas* reservas, const char* filename,
                               size_t num_reservas, uint32_t codigo_reserva)
 {
     std::ofstream archivo(filename);
@@ -855,10 +934,13 @@ static void escribir_reservas(Unordered_Map<uint32_t, Reserva>* reservas, const
         return;
     }
     archivo << num_reservas << " " << codigo_reserva << "\n";
+    Escritor_Lineas escritor(archivo);
     //Aquí vengo a usar un poquito de programación funcional y aprovecharme de características de C++
-    //Lo que llaman sugar syntax
-    //El callback se encarga de escribir la reserva en el archivo
-    reservas->for_each(escribir_reserva_callback, &archivo);
+    //La lambda se instancia dentro de for_each, así que la escritura queda en un ciclo sin llamadas indirectas
+    reservas->for_each([&escritor](uint32_t codigo_reserva, Reserva *reserva) {
+        escribir_reserva(escritor, reserva);
+    });
+    escritor.vaciar();
     archivo.close();
 }
 
@@ -870,27 +952,37 @@ void opcion_consultar_reservaciones(Anfitrion *anfitrion_user)
 {
     char fecha_inicio[LONG_FECHA_CADENA + 1];
     char fecha_fin[LONG_FECHA_CADENA + 1];
-    Fecha *fecha_inicio_obj = nullptr;
-    Fecha *fecha_fin_obj = nullptr;
+    Fecha fecha_inicio_obj;
+    Fecha fecha_fin_obj;
 
     std::cout << "Consulta por fecha\nDesde: (dd/mm/aaaa): ";
     std::cin >> fecha_inicio;
     std::cout << "Hasta: (dd/mm/aaaa): ";
     std::cin >> fecha_fin;
     std::cout << "Activas desde: " << fecha_inicio << " hasta: " << fecha_fin << std::endl;
-    fecha_inicio_obj = new Fecha();
-    fecha_fin_obj = new Fecha();
-    if (fecha_inicio_obj->cargar_desde_cadena(fecha_inicio) && fecha_fin_obj->cargar_desde_cadena(fecha_fin))
-        anfitrion_user->mostrar_alojamientos(*fecha_inicio_obj, *fecha_fin_obj);
+    if (fecha_inicio_obj.cargar_desde_cadena(fecha_inicio) && fecha_fin_obj.cargar_desde_cadena(fecha_fin))
+        anfitrion_user->mostrar_alojamientos(fecha_inicio_obj, fecha_fin_obj);
     else 
         std::cerr << "Revise el formato de las fechas" << std::endl;
-    delete fecha_inicio_obj;
-    delete fecha_fin_obj;
     g_ciclos = 0;
     imprimir_contadores("Mostrar reservas");
     std::cout << "Se hicieron " << g_ciclos << " ciclos para mostrar las reservas" << std::endl;
     std::cout << "Los objetos pesan " << g_tamano << " bytes de memoria" << std::endl;
 }
+/**
+ * @brief Activa el calendario de ocupación de cada alojamiento a partir de la fecha del sistema.
+ * Se llama después de cargar las reservas para que cada calendario las marque de una vez.
+ * @param Alojamientos Mapa de alojamientos cargados.
+ * @param fecha_sistema Fecha del sistema actual.
+ */
+static void iniciar_calendarios(Mapa_Alojamientos *Alojamientos, Fecha *fecha_sistema)
+{
+    Alojamientos->for_each([fecha_sistema](uint32_t, Alojamiento *alojamiento) {
+        alojamiento->iniciar_calendario(*fecha_sistema);
+        g_ciclos++;
+    });
+}
+
 /**
  * @brief Zona de operaciones para el anfitrión.
  * 
@@ -913,10 +1005,13 @@ void zona_anfitrion(Fecha *fecha_sistema)
     size_t num_reservas = 0;
     uint32_t codigo_reserva = 0;
     bool update_reservas = false;
-    Unordered_Map<uint32_t, Alojamiento>* Alojamientos = nullptr;
-    Unordered_Map<uint32_t, Reserva>* Reservas = nullptr;
+    Mapa_Alojamientos* Alojamientos = nullptr;
+    Mapa_Reservas* Reservas = nullptr;
+    Tabla_Reservas tabla_reservas;
+    //Los textos de alojamientos y reservas de la sesión; se liberan juntos al salir
+    Arena_Cadenas arena;
     
-    Alojamientos = leer_alojamientos(ALOJAMIENTO_FILE, anfitrion_user);
+    Alojamientos = leer_alojamientos(ALOJAMIENTO_FILE, anfitrion_user, &arena);
     if (Alojamientos == nullptr) {
         imprimir_contadores("Cargar datos en memoria");
         std::cout << "Se hicieron " << g_ciclos << " ciclos cargar los datos en memoria" << std::endl;
@@ -925,7 +1020,7 @@ void zona_anfitrion(Fecha *fecha_sistema)
         delete anfitrion_user;
         return;
     }
-    Reservas = leer_reservas(RESERVAS_FILE, Alojamientos, nullptr, num_reservas, codigo_reserva);
+    Reservas = leer_reservas(RESERVAS_FILE, Alojamientos, nullptr, &tabla_reservas, &arena, num_reservas, codigo_reserva);
     if (Reservas == nullptr) {
         imprimir_contadores("Cargar datos en memoria");
         std::cout << "Se hicieron " << g_ciclos << " ciclos cargar los datos en memoria" << std::endl;
@@ -936,8 +1031,11 @@ void zona_anfitrion(Fecha *fecha_sistema)
         delete Alojamientos;
         return;
     }
-    g_tamano += Alojamientos->info_map() + Reservas->info_map();
+    iniciar_calendarios(Alojamientos, fecha_sistema);
+    //Las tablas de los mapas ya se contaron al reservarlas; falta el objeto de cada mapa
+    g_tamano += sizeof(*Alojamientos) + sizeof(*Reservas) + tabla_reservas.get_bytes();
     imprimir_contadores("Cargar datos en memoria");
+    imprimir_estadisticas_mapas(nullptr, Alojamientos, Reservas);
     std::cout << "Se hicieron " << g_ciclos << " ciclos cargar los datos en memoria" << std::endl;
     std::cout << "Se usaron " << g_tamano << " bytes de memoria" << std::endl;
     g_ciclos = 0;
@@ -962,7 +1060,7 @@ void zona_anfitrion(Fecha *fecha_sistema)
                 break;
             case 3:
                 std::cout << "Crear histórico de reservas" << std::endl;
-                update_reservas = crear_historico_reservas(Reservas, HISTORICO_FILE, anfitrion_user, fecha_sistema, num_reservas);
+                update_reservas = crear_historico_reservas(Reservas, &tabla_reservas, HISTORICO_FILE, anfitrion_user, fecha_sistema, num_reservas);
                 imprimir_contadores("Crear histórico de reservas");
                 std::cout << "Se hicieron " << g_ciclos << " ciclos para crear el histórico" << std::endl;
                 std::cout << "Los objetos pesan " << g_tamano << " bytes de memoria" << std::endl;
@@ -992,6 +1090,8 @@ void zona_anfitrion(Fecha *fecha_sistema)
         std::cout << "Reservas actualizadas." << std::endl;
     }
 
+    //Se sueltan las filas de una vez para que cada reserva no tenga que borrar la suya
+    tabla_reservas.clear();
     if (Reservas != nullptr) {
         Reservas->clear_values();
         delete Reservas;
@@ -1007,86 +1107,60 @@ void zona_anfitrion(Fecha *fecha_sistema)
  */
 static bool comparar_fecha_reservas(Reserva *reserva_1, Reserva *reserva_2)
 {
-    return (*reserva_1->get_fecha_salida()) < (*reserva_2->get_fecha_salida());
-}
-/**
- * @brief Agrega una reserva al histórico de reservas y la elimina de las reservas del anfitrión.
- * @param codigo_reserva Código de la reserva.
- * @param reserva Puntero a la reserva a agregar al histórico.
- * @param archivo Puntero al archivo donde se escribirá el histórico.
- * @param fecha Fecha de corte para el histórico.
- * @param anfitrion Puntero al anfitrión que está creando el histórico.
- * @param params Parámetros adicionales para el callback (archivo, fecha, anfitrion, historico)
- */
-static void agregar_historico_reservas(uint32_t codigo_reserva, Reserva* reserva, void* params)
-{
-    callback_param_historico *param = reinterpret_cast<callback_param_historico*>(params);
-    if (reserva == nullptr)
-        return;
-
-    if (*(reserva->get_fecha_salida()) >= *(param->fecha))
-        return;
-    
-    param->anfitrion->eliminar_reserva(reserva);
-    param->historico->insert_sorted(reserva, comparar_fecha_reservas);
+    return reserva_1->get_fecha_salida() < reserva_2->get_fecha_salida();
 }
-
 /**
  * @brief Crea un archivo histórico de reservas.
  * 
  * @param Reservas Mapa hash que contiene las reservas a escribir.
+ * @param tabla Tabla por columnas de las reservas; de ella se leen las fechas de salida.
  * @param filename Nombre del archivo donde se guardarán las reservas.
  * @param anfitrion Puntero al anfitrión que está creando el histórico.
  * @param fecha_sistema Fecha del sistema actual.
  * @param num_reservas Número de reservas a escribir.
  */
-static bool crear_historico_reservas(Unordered_Map<uint32_t, Reserva>* Reservas, const char* filename, 
+static bool crear_historico_reservas(Mapa_Reservas* Reservas, Tabla_Reservas *tabla, const char* filename, 
                                      Anfitrion* anfitrion, Fecha *fecha_sistema, size_t &num_reservas)
 {
     std::ofstream archivo(filename, std::ios::app);
-    struct callback_param_historico params = {&archivo, fecha_sistema, anfitrion};
-    params.historico = new Linked_List<Reserva*>();
+    Linked_List<Reserva*> *historico = new Linked_List<Reserva*>();
 
-    if (params.historico == nullptr) {
+    if (historico == nullptr) {
         std::cerr << "Error al crear la lista de histórico." << std::endl;
         return false;
     }
 
     if (!archivo.is_open()) {
         std::cerr << "Error al abrir el archivo para escribir el historico." << std::endl;
+        delete historico;
         return false;
     }
 
-    Reservas->for_each(agregar_historico_reservas, &params);
+    //Las reservas que ya terminaron se sacan del anfitrión y pasan al histórico.
+    //La tabla por columnas solo lee entrada y noches de cada reserva para decidirlo.
+    tabla->for_each_salida_antes(*fecha_sistema, [&](Reserva *reserva) {
+        anfitrion->eliminar_reserva(reserva);
+        historico->insert_front(reserva);
+    });
     
-    if (params.historico->get_size() == 0) {
-        delete params.historico;
+    if (historico->get_size() == 0) {
+        delete historico;
         return false;
     }
+
+    //Se ordenan una sola vez por fecha de salida
+    historico->sort(comparar_fecha_reservas);
     std::cout << "Histórico de reservas creado con éxito." << std::endl;
-    Node<Reserva*> *current = params.historico->get_head();
-    char buffer[LONG_FECHA_CADENA + 1] = {0};
+    Escritor_Lineas escritor(archivo);
 
-    while (current != nullptr) {
-        g_ciclos++;
-        current->data->get_fecha_entrada()->a_cadena(buffer);
-        archivo << buffer << ";";
-        archivo << current->data->get_duracion() << ";";
-        archivo << current->data->get_codigo_reserva() << ";";
-        archivo << current->data->get_codigo_alojamiento() << ";";
-        archivo << current->data->get_documento_huesped() << ";";
-        archivo << current->data->get_metodo_pago() << ";";
-        archivo << current->data->get_fecha_pago()->a_cadena(buffer) << ";";
-        archivo << current->data->get_monto() << ";";
-        archivo << (current->data->get_anotaciones() ? current->data->get_anotaciones() : "") << "\n";
-        Reserva *tmp = Reservas->erase(current->data->get_codigo_reserva());
-        delete tmp;
-        current = current->next;
+    for (Reserva *reserva : *historico) {
+        escribir_reserva(escritor, reserva);
+        Reservas->erase(reserva->get_codigo_reserva());
         num_reservas--;
     }
     
-    delete params.historico;
-    params.historico = nullptr;
+    escritor.vaciar();
+    delete historico;
     archivo.close();
     
     return true;
@@ -1095,101 +1169,94 @@ static bool crear_historico_reservas(Unordered_Map<uint32_t, Reserva>* Reservas,
 /**
  * @brief Obtiene la fecha de entrada de la futura reservacion
  * @param sistema fecha del sistema
+ * @param fecha_inicio_obj Fecha de entrada leída
+ * @return true si la fecha es válida para reservar
  */
-static Fecha *obtener_fecha_entrada(Fecha *sistema)
+static bool obtener_fecha_entrada(const Fecha &sistema, Fecha &fecha_inicio_obj)
 {
     char fecha_inicio[LONG_FECHA_CADENA + 1];
-    Fecha *fecha_inicio_obj = new Fecha();
-    Fecha *fecha_maxima_obj = nullptr;
     std::cout << "Ingrese la fecha de inicio (dd/mm/aaaa): ";
     std::cin >> fecha_inicio;
-    fecha_inicio_obj->cargar_desde_cadena(fecha_inicio);
+    fecha_inicio_obj.cargar_desde_cadena(fecha_inicio);
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-    if (*fecha_inicio_obj < *sistema) {
-        delete fecha_inicio_obj;
+    if (fecha_inicio_obj < sistema) {
         std::cerr << "La fecha de inicio no puede ser anterior a la fecha del sistema." << std::endl;
-        return nullptr;
+        return false;
     }
 
-    fecha_maxima_obj = sistema->agregar_anios(1);
-
-    if (*fecha_inicio_obj >= *fecha_maxima_obj) {
-        delete fecha_maxima_obj;
-        delete fecha_inicio_obj;
+    if (fecha_inicio_obj >= sistema.agregar_anios(1)) {
         std::cerr << "No se pueden hacer reservas para dentro de más de un año" << std::endl;
-        return nullptr;
+        return false;
     }
 
-    delete fecha_maxima_obj;
-
-    return fecha_inicio_obj;
+    return true;
 }
 
-static Fecha *obtener_duracion_reserva(uint16_t &duracion, Fecha *inicio_reservacion)
+/**
+ * @brief Obtiene la duración de la reservación y su fecha de salida
+ * @param duracion Noches leídas
+ * @param inicio_reservacion Fecha de entrada
+ * @param fin_reservacion Fecha de salida calculada
+ * @return true si la reservación no pasa de un año
+ */
+static bool obtener_duracion_reserva(uint16_t &duracion, const Fecha &inicio_reservacion, Fecha &fin_reservacion)
 {
     std::cout << "Escriba la duración en noches de su reservación" << std::endl;
     get_int_16(duracion);
     
-    Fecha *fin_reservacion = inicio_reservacion->sumar_noches(duracion);
-    Fecha *maxima = inicio_reservacion->agregar_anios(1);
+    fin_reservacion = inicio_reservacion.sumar_noches(duracion);
 
-    if (*fin_reservacion > *maxima) {
-        delete fin_reservacion;
-        delete maxima;
+    if (fin_reservacion > inicio_reservacion.agregar_anios(1)) {
         std::cerr << "No se puede reservar hasta una fecha posterior a un año" << std::endl;
         duracion = 0;
-        return nullptr;
+        return false;
     }
 
-    return fin_reservacion;
-}
-
-/**
- * @brief Callback para validar alojamientos. Esta función la llama el mapa hash
- * @param codigo_alojamiento Código del alojamiento.
- * @param aloj Puntero al alojamiento a validar.
- * @param params Parámetros adicionales para la validación.
- */
-static void validar_alojamientos(uint32_t codigo_alojamiento, Alojamiento* aloj, void* params)
-{
-    callback_param_reservacion *param = reinterpret_cast<callback_param_reservacion*>(params);
-    if (aloj == nullptr)
-        return;
-
-    if(aloj->es_candidato_reserva(*param->inicio, *param->fin, *(param->mpo))) {
-        param->alojamientos->insert_front(aloj);
-    }
+    return true;
 }
 
-bool mostrar_alojamientos_disponibles(Linked_List<Alojamiento*> *alojamientos, 
-                                    Linked_List<Alojamiento*> *disponibles, 
-                                    Unordered_Map<uint64_t, Anfitrion> *anfitrion, 
-                                    float precio, float puntuacion)
+bool mostrar_alojamientos_disponibles(const Lista_Alojamientos &alojamientos, 
+                                    Lista_Alojamientos &disponibles, 
+                                    Mapa_Anfitriones *anfitrion, 
+                                    float puntuacion)
 {
     bool encontrado = false;
-    if (alojamientos == nullptr || alojamientos->get_size() == 0) {
+    if (alojamientos.is_empty()) {
         std::cerr << "No se encontraron alojamientos disponibles." << std::endl;
         return encontrado;
     }
 
-    Node<Alojamiento*> *current = alojamientos->get_head();
-    while (current != nullptr) {
-        Alojamiento *alojamiento = current->data;
-        Anfitrion *anfitrion_user = anfitrion->find(alojamiento->get_codigo_anfitrion());
-        if (anfitrion_user != nullptr) {
-            bool cumple_precio = (precio == 0.0f || alojamiento->get_precio() <= precio);
+    uint64_t documentos[LOTE_BUSQUEDAS];
+    Anfitrion *anfitriones[LOTE_BUSQUEDAS];
+
+    //Los anfitriones se buscan por lotes para solapar los accesos al mapa
+    for (uint32_t inicio = 0; inicio < alojamientos.get_size(); inicio += LOTE_BUSQUEDAS) {
+        Alojamiento *const *lote = alojamientos.begin() + inicio;
+        size_t n = alojamientos.get_size() - inicio;
+        if (n > LOTE_BUSQUEDAS)
+            n = LOTE_BUSQUEDAS;
+
+        for (size_t i = 0; i < n; ++i, g_ciclos++)
+            documentos[i] = lote[i]->get_codigo_anfitrion();
+
+        anfitrion->find_many(documentos, n, anfitriones);
+
+        for (size_t i = 0; i < n; ++i) {
+            Alojamiento *alojamiento = lote[i];
+            Anfitrion *anfitrion_user = anfitriones[i];
+            if (anfitrion_user == nullptr)
+                continue;
+
             bool cumple_puntuacion = (puntuacion == 0.0f || anfitrion_user->get_puntuacion() >= puntuacion);
 
-            if (cumple_precio && cumple_puntuacion) {
+            if (cumple_puntuacion) {
                 encontrado = true;
-                disponibles->insert_front(alojamiento);
+                disponibles.push_back(alojamiento);
                 alojamiento->mostrar_alojamiento();
                 std::cout << "Calificación: " << anfitrion_user->get_puntuacion() << std::endl;
             }
         }
-        current = current->next;
-        g_ciclos++;
     }
 
     return encontrado;
@@ -1202,24 +1269,19 @@ bool mostrar_alojamientos_disponibles(Linked_List<Alojamiento*> *alojamientos,
  * @return true si el alojamiento existe, false en caso contrario.
  */
 
-Alojamiento *existe_alojamiento(Linked_List<Alojamiento*> *alojamientos, uint32_t codigo_alojamiento)
+Alojamiento *existe_alojamiento(const Lista_Alojamientos &alojamientos, uint32_t codigo_alojamiento)
 {
-    if (alojamientos == nullptr || alojamientos->get_size() == 0)
-        return nullptr;
-
-    Node<Alojamiento*> *current = alojamientos->get_head();
-    while (current != nullptr) {
-        if (current->data->get_id() == codigo_alojamiento)
-            return current->data;
-        current = current->next;
+    for (Alojamiento *alojamiento : alojamientos) {
+        if (alojamiento->get_id() == codigo_alojamiento)
+            return alojamiento;
         g_ciclos++;
     }
     return nullptr;
 }
 
-static Reserva *crear_reservacion_codigo(Unordered_Map<uint32_t, Alojamiento> *Alojamientos, 
-    Unordered_Map<uint64_t, Anfitrion> *Anfitriones, Fecha *sistema, uint32_t &codigo_reserva,
-    Huesped *huesped)
+static Reserva *crear_reservacion_codigo(Mapa_Alojamientos *Alojamientos, 
+    Mapa_Anfitriones *Anfitriones, Fecha *sistema, uint32_t &codigo_reserva,
+    Huesped *huesped, Mapa_Reservas *Reservas, Arena_Cadenas *arena)
 {
     uint16_t duracion;
     size_t ciclos_cnt = 0;
@@ -1236,37 +1298,30 @@ static Reserva *crear_reservacion_codigo(Unordered_Map<uint32_t, Alojamiento> *A
     }
     alojamiento->mostrar_alojamiento();
     //Se obtiene la fecha de inicio
-    Fecha *inicio_reservacion = obtener_fecha_entrada(sistema);
-    Fecha *finalizacion_reservacion = nullptr;
+    Fecha inicio_reservacion;
+    Fecha finalizacion_reservacion;
 
-    if (inicio_reservacion == nullptr) {
+    if (!obtener_fecha_entrada(*sistema, inicio_reservacion)) {
         return nullptr;
     }
 
     //Se obtiene la duración y, por tanto, la fecha de finalización
-    finalizacion_reservacion = obtener_duracion_reserva(duracion, inicio_reservacion);
-
-    if (finalizacion_reservacion == nullptr) {
-        delete inicio_reservacion;
+    if (!obtener_duracion_reserva(duracion, inicio_reservacion, finalizacion_reservacion)) {
         return nullptr;
     }
 
     if (huesped->tengo_reservas(inicio_reservacion, finalizacion_reservacion)) {
         std::cerr << "Ya tiene una reserva en esas fechas." << std::endl;
-        delete inicio_reservacion;
-        delete finalizacion_reservacion;
         return nullptr;
     }
 
-    if (!alojamiento->es_candidato_reserva(*inicio_reservacion, *finalizacion_reservacion)) {
+    if (!alojamiento->es_candidato_reserva(inicio_reservacion, finalizacion_reservacion)) {
         std::cerr << "El alojamiento no está disponible en esas fechas." << std::endl;
-        delete inicio_reservacion;
-        delete finalizacion_reservacion;
         return nullptr;
     }
 
     Reserva *reserva = agregar_reserva(alojamiento, codigo_reserva, duracion, inicio_reservacion, 
-                                       finalizacion_reservacion, huesped, sistema);
+                                       finalizacion_reservacion, huesped, sistema, Reservas, arena);
     
     return reserva;
     
@@ -1275,40 +1330,40 @@ static Reserva *crear_reservacion_codigo(Unordered_Map<uint32_t, Alojamiento> *A
  * @brief Crea una nueva reservacion
  * @param Alojamientos Mapa de alojamientos
  * @param Fecha del sistema
+ * @param Reservas Mapa de reservas donde se construye la nueva reserva
+ * @param arena Arena donde se guardan las anotaciones de la reserva
+ * @param Municipios Índice de los alojamientos por municipio
  * @return Puntero a la nueva reservacion
  */
-static Reserva * crear_reservacion(Unordered_Map<uint32_t, Alojamiento> *Alojamientos, 
-    Unordered_Map<uint64_t, Anfitrion> *Anfitriones, Fecha *sistema, uint32_t &codigo_reserva,
-    Huesped *huesped)
+static Reserva * crear_reservacion(Mapa_Alojamientos *Alojamientos, 
+    Mapa_Anfitriones *Anfitriones, Fecha *sistema, uint32_t &codigo_reserva,
+    Huesped *huesped, Mapa_Reservas *Reservas, Arena_Cadenas *arena,
+    const Indice_Municipios *Municipios)
 {
     //Todas las variables o estructuras necesarias para crear la reservación
     uint16_t duracion;
     std::string municipio;
-    struct callback_param_reservacion params = {nullptr, nullptr, nullptr, nullptr};
+    Lista_Alojamientos alojamientos;
+    Lista_Alojamientos alojamientos_disponibles;
     std::string departamento;
     float puntuacion, precio;
     char fecha[LONG_FECHA_CADENA + 1] = {0};
     //Se obtiene la fecha de inicio
-    Fecha *inicio_reservacion = obtener_fecha_entrada(sistema);
-    Fecha *finalizacion_reservacion = nullptr;
+    Fecha inicio_reservacion;
+    Fecha finalizacion_reservacion;
 
-    if (inicio_reservacion == nullptr) {
+    if (!obtener_fecha_entrada(*sistema, inicio_reservacion)) {
         return nullptr;
     }
 
     //Se obtiene la duración y, por tanto, la fecha de finalización
-    finalizacion_reservacion = obtener_duracion_reserva(duracion, inicio_reservacion);
-
-    if (huesped->tengo_reservas(inicio_reservacion, finalizacion_reservacion)) {
-        delete inicio_reservacion;
-        delete finalizacion_reservacion;
-        std::cout << "Ya tiene una reserva en esas fechas." << std::endl;
+    if (!obtener_duracion_reserva(duracion, inicio_reservacion, finalizacion_reservacion)) {
+        std::cerr << "Error al obtener la fecha de finalización." << std::endl;
         return nullptr;
     }
 
-    if (finalizacion_reservacion == nullptr) {
-        delete inicio_reservacion;
-        std::cerr << "Error al obtener la fecha de finalización." << std::endl;
+    if (huesped->tengo_reservas(inicio_reservacion, finalizacion_reservacion)) {
+        std::cout << "Ya tiene una reserva en esas fechas." << std::endl;
         return nullptr;
     }
 
@@ -1316,23 +1371,6 @@ static Reserva * crear_reservacion(Unordered_Map<uint32_t, Alojamiento> *Alojami
     std::cout << "Ingrese el municipio: ";
     getline(std::cin, municipio);
     g_string_legnth_cnt++;
-    params.inicio = inicio_reservacion;
-    params.fin = finalizacion_reservacion;
-    params.mpo = &municipio;
-
-    //Se crea la lista de alojamientos disponibles
-    params.alojamientos = new Linked_List<Alojamiento*>();
-
-    //Se valida que los alojamientos existan y estén disponibles
-    Alojamientos->for_each(validar_alojamientos, &params);
-
-    if (params.alojamientos->get_size() == 0) {
-        delete params.alojamientos;
-        delete inicio_reservacion;
-        delete finalizacion_reservacion;
-        std::cerr << "No se encontraron alojamientos disponibles." << std::endl;
-        return nullptr;
-    }
 
     std::cout << "Ahora podrá elegir filtros adicionales para su reservación. Simplemente presione 0 para omitir el filtro" << std::endl;
     std::cout << "Precio maximo por noche: ";
@@ -1340,37 +1378,42 @@ static Reserva * crear_reservacion(Unordered_Map<uint32_t, Alojamiento> *Alojami
     std::cout << "Mínima calificación anfitrión: ";
     get_float(puntuacion);
 
-    params.alojamientos_disponibles = new Linked_List<Alojamiento*>();
+    //Solo se revisa la disponibilidad de los alojamientos del municipio que entran en el presupuesto
+    const Grupo_Municipio *grupo = Municipios->buscar(municipio);
+    if (grupo != nullptr) {
+        uint32_t en_presupuesto = Indice_Municipios::hasta_precio(*grupo, precio);
+        for (uint32_t i = 0; i < en_presupuesto; ++i, g_ciclos++) {
+            Alojamiento *aloj = (*grupo)[i];
+            if (aloj->es_candidato_reserva(inicio_reservacion, finalizacion_reservacion))
+                alojamientos.push_back(aloj);
+        }
+    }
 
-    if (!mostrar_alojamientos_disponibles(params.alojamientos, params.alojamientos_disponibles, 
-                                        Anfitriones, precio, puntuacion)) {
-        delete params.alojamientos;
-        delete inicio_reservacion;
-        delete finalizacion_reservacion;
+    if (alojamientos.is_empty()) {
         std::cerr << "No se encontraron alojamientos disponibles." << std::endl;
         return nullptr;
     }
 
-    delete params.alojamientos;
+    if (!mostrar_alojamientos_disponibles(alojamientos, alojamientos_disponibles, 
+                                        Anfitriones, puntuacion)) {
+        std::cerr << "No se encontraron alojamientos disponibles." << std::endl;
+        return nullptr;
+    }
 
     //Se muestran los alojamientos disponibles y se permite al usuario elegir uno
     std::cout << "Seleccione el código del alojamiento que desea reservar: ";
     uint32_t codigo_alojamiento;
     get_int(codigo_alojamiento);
 
-    Alojamiento *aloj = existe_alojamiento(params.alojamientos_disponibles, codigo_alojamiento);
+    Alojamiento *aloj = existe_alojamiento(alojamientos_disponibles, codigo_alojamiento);
 
     if (aloj == nullptr) {
-        delete params.alojamientos_disponibles;
-        delete inicio_reservacion;
-        delete finalizacion_reservacion;
         std::cerr << "El alojamiento no existe." << std::endl;
         return nullptr;
     }
-    delete params.alojamientos_disponibles;
     //Ahora se crea la reserva
     Reserva *reserva = agregar_reserva(aloj, codigo_reserva, duracion, inicio_reservacion, 
-                                       finalizacion_reservacion, huesped, sistema);
+                                       finalizacion_reservacion, huesped, sistema, Reservas, arena);
     return reserva;
 }
 
@@ -1383,11 +1426,14 @@ static Reserva * crear_reservacion(Unordered_Map<uint32_t, Alojamiento> *Alojami
  * @param fecha_salida Fecha de salida.
  * @param huesped Huésped que realiza la reserva.
  * @param sistema Fecha del sistema.
+ * @param Reservas Mapa de reservas donde se construye la nueva reserva.
+ * @param arena Arena donde se guardan las anotaciones de la reserva.
  * @return Reserva* Puntero a la nueva reserva creada.
  */
 
 Reserva *agregar_reserva(Alojamiento *aloj, uint32_t codigo_reserva, uint16_t duracion, 
-    Fecha *fecha_entrada, Fecha *fecha_salida, Huesped *huesped, Fecha *sistema)
+    const Fecha &fecha_entrada, const Fecha &fecha_salida, Huesped *huesped, Fecha *sistema,
+    Mapa_Reservas *Reservas, Arena_Cadenas *arena)
 {
     char pago = 0;
 
@@ -1401,15 +1447,15 @@ Reserva *agregar_reserva(Alojamiento *aloj, uint32_t codigo_reserva, uint16_t du
     std::string anotaciones;
 
     char fch_pago[LONG_FECHA_CADENA + 1] = {0};
-    Fecha *fecha_pago = new Fecha();
+    Fecha fecha_pago;
     bool valida = false;
 
     do {
         std::cout << "Escriba la fecha de pago (dd/mm/aaaa): ";
         std::cin.getline(fch_pago, LONG_FECHA_CADENA + 1);
         g_getline_cnt++;
-        bool valida = fecha_pago->cargar_desde_cadena(fch_pago);
-    } while (!valida && (*fecha_pago > *sistema));
+        bool valida = fecha_pago.cargar_desde_cadena(fch_pago);
+    } while (!valida && (fecha_pago > *sistema));
 
     do {
         std::cout << "Escriba sus anotaciones (1000 caracteres max): ";
@@ -1422,11 +1468,11 @@ Reserva *agregar_reserva(Alojamiento *aloj, uint32_t codigo_reserva, uint16_t du
     g_c_string_cnt++;
     codigo_reserva++;
 
-    Reserva *reserva = new Reserva(fecha_entrada,fecha_salida, duracion,
+    Reserva *reserva = Reservas->emplace(codigo_reserva, fecha_entrada, fecha_salida, duracion,
                  codigo_reserva, aloj->get_id(),
                  huesped->get_documento(), pago,
                  fecha_pago, monto,
-                 notas);
+                 notas, arena);
     
     huesped->set_reserva(reserva);
     aloj->set_reserva(reserva);
@@ -1439,11 +1485,15 @@ Reserva *agregar_reserva(Alojamiento *aloj, uint32_t codigo_reserva, uint16_t du
  * @param sistema Fecha del sistema.
  * @param codigo_reserva Código de la reserva.
  * @param huesped Huésped que realiza la reserva.
+ * @param Reservas Mapa de reservas donde se construye la nueva reserva.
+ * @param arena Arena donde se guardan las anotaciones de la reserva.
+ * @param Municipios Índice de los alojamientos por municipio.
  * @return Reserva* Puntero a la nueva reserva creada.
  */
-Reserva *menu_reservacion(Unordered_Map<uint32_t, Alojamiento> *Alojamientos, 
-    Unordered_Map<uint64_t, Anfitrion> *Anfitriones, Fecha *sistema, uint32_t &codigo_reserva,
-    Huesped *huesped)
+Reserva *menu_reservacion(Mapa_Alojamientos *Alojamientos, 
+    Mapa_Anfitriones *Anfitriones, Fecha *sistema, uint32_t &codigo_reserva,
+    Huesped *huesped, Mapa_Reservas *Reservas, Arena_Cadenas *arena,
+    const Indice_Municipios *Municipios)
 {
     uint8_t opc = 0;
     Reserva *reserva = nullptr;
@@ -1458,11 +1508,11 @@ Reserva *menu_reservacion(Unordered_Map<uint32_t, Alojamiento> *Alojamientos,
     switch (opc) {
         case 1:
             std::cout << "Crear reservación por código" << std::endl;
-            reserva = crear_reservacion_codigo(Alojamientos, Anfitriones, sistema, codigo_reserva, huesped);
+            reserva = crear_reservacion_codigo(Alojamientos, Anfitriones, sistema, codigo_reserva, huesped, Reservas, arena);
             break;
         case 2:
             std::cout << "Crear reservación con filtros" << std::endl;
-            reserva = crear_reservacion(Alojamientos, Anfitriones, sistema, codigo_reserva, huesped);
+            reserva = crear_reservacion(Alojamientos, Anfitriones, sistema, codigo_reserva, huesped, Reservas, arena, Municipios);
             break;
         case 3:
             std::cout << "Saliendo..." << std::endl;
@@ -1482,25 +1532,27 @@ Reserva *menu_reservacion(Unordered_Map<uint32_t, Alojamiento> *Alojamientos,
  * @param Alojamientos mapa con punteros a los objetos de alojamientos
  * @param Anfitriones mapa con punteros a los anfitriones
  * @param Reservas mapa con punteros a las reservas
+ * @param arena Arena de los textos de la sesión
+ * @param Municipios índice de los alojamientos por municipio
  * @param fecha_sistema puntero a la fecha actual del sistema
  * @param huesped_user puntero al usuario huesped
  * @param codigo_reserva referencia a la variable que mantiene el control de las reservas
  * @param num_reservas referencia al número de reservas
  * @param update_reservas referencia a una variable booleana que controla si se debe actualizar o no una reserva
  */
-void opcion_agregar_reserva(Unordered_Map<uint32_t, Alojamiento> *Alojamientos, 
-                    Unordered_Map<uint32_t, Reserva> *Reservas,
-                    Unordered_Map<uint64_t, Anfitrion> *Anfitriones,
+void opcion_agregar_reserva(Mapa_Alojamientos *Alojamientos, 
+                    Mapa_Reservas *Reservas, Arena_Cadenas *arena,
+                    const Indice_Municipios *Municipios,
+                    Mapa_Anfitriones *Anfitriones,
                     Fecha *fecha_sistema, Huesped *huesped_user, uint32_t &codigo_reserva,
                     size_t &num_reservas, bool &update_reservas)
 {
     Reserva *reserva = nullptr;
     std::cout << "Crear reservación" << std::endl;
-    reserva = menu_reservacion(Alojamientos, Anfitriones, fecha_sistema, codigo_reserva, huesped_user);
+    reserva = menu_reservacion(Alojamientos, Anfitriones, fecha_sistema, codigo_reserva, huesped_user, Reservas, arena, Municipios);
     if(reserva != nullptr) {
         codigo_reserva = reserva->get_codigo_reserva();
         num_reservas++;
-        Reservas->insert(codigo_reserva, reserva);
         update_reservas = true;
         g_tamano += reserva->get_size();
         imprimir_contadores("Crear reservación");
@@ -1523,7 +1575,7 @@ void opcion_agregar_reserva(Unordered_Map<uint32_t, Alojamiento> *Alojamientos,
  * @param num_reservas referencia al número de reservas
  * @param update_reservas referencia a una variable booleana que controla si se debe actualizar o no una reserva
  */
-void opcion_anular_reservacion_anfitrion(Unordered_Map<uint32_t, Reserva> *Reservas, 
+void opcion_anular_reservacion_anfitrion(Mapa_Reservas *Reservas, 
                                         Anfitrion *anfitrion_user, size_t &num_reservas,
                                         bool &update_reservas)
 {
@@ -1544,8 +1596,7 @@ void opcion_anular_reservacion_anfitrion(Unordered_Map<uint32_t, Reserva> *Reser
     if (anfitrion_user->eliminar_reserva(reserva)) {
         num_reservas--;
         escribir_cancelaciones(reserva, CANCELACIONES_FILE);
-        Reserva *tmp = Reservas->erase(codigo_reserva);
-        delete tmp;
+        Reservas->erase(codigo_reserva);
         update_reservas = true;
     }
 
@@ -1558,13 +1609,11 @@ void opcion_anular_reservacion_anfitrion(Unordered_Map<uint32_t, Reserva> *Reser
 /**
  * @brief función que presenta el menú para eliminar una reservación de un huesped
  * Llama a todos los métodos de las clases involucradas para eliminar la reservación
- * @param Alojamientos mapa con punteros a los alojamientso
  * @param Reservas mapa con punteros a los mapas
  * @param huesped_user Puntero del usuario que va a eliminar su reservación
  */
 
-void opcion_anular_reservacion_huesped(Unordered_Map<uint32_t, Alojamiento> *Alojamientos,
-                                Unordered_Map<uint32_t, Reserva> *Reservas,
+void opcion_anular_reservacion_huesped(Mapa_Reservas *Reservas,
                                 Huesped *huesped_user, size_t &num_reservas,
                                 bool &update_reservas)
 {
@@ -1586,10 +1635,12 @@ void opcion_anular_reservacion_huesped(Unordered_Map<uint32_t, Alojamiento> *Alo
 
     if (huesped_user->eliminar_reserva(reserva)) {
         num_reservas--;
-        Alojamientos->find(reserva->get_codigo_alojamiento())->eliminar_reserva(reserva->get_codigo_reserva());
+        //La reserva conoce su alojamiento y sale de su lista sin buscarlo en el mapa
+        Alojamiento *alojamiento = reserva->get_alojamiento();
+        if (alojamiento != nullptr)
+            alojamiento->eliminar_reserva(reserva);
         escribir_cancelaciones(reserva, CANCELACIONES_FILE);
-        Reserva *reserva = Reservas->erase(cod_buscar_reserva);
-        delete reserva;
+        Reservas->erase(cod_buscar_reserva);
         update_reservas = true;
     }
 
@@ -1599,6 +1650,21 @@ void opcion_anular_reservacion_huesped(Unordered_Map<uint32_t, Alojamiento> *Alo
     std::cout << "Los objetos creados ocupan: " << g_tamano << " bytes" << std::endl;
 }
 
+/**
+ * @brief Arma el índice de municipios con todos los alojamientos cargados.
+ * @param Alojamientos Mapa de alojamientos cargados.
+ * @param Municipios Índice vacío que se llena.
+ */
+static void indexar_municipios(Mapa_Alojamientos *Alojamientos, Indice_Municipios *Municipios)
+{
+    //Se anexan sin ordenar y cada grupo se ordena una vez, en vez de correr la cola en cada alta
+    Alojamientos->for_each([Municipios](uint32_t, Alojamiento *alojamiento) {
+        Municipios->anexar(alojamiento);
+        g_ciclos++;
+    });
+    Municipios->ordenar();
+}
+
 /**
  * @brief Zona de operaciones para el huésped.
  * 
@@ -1623,9 +1689,11 @@ void zona_huesped(Fecha *fecha_sistema)
     g_ciclos = 0;
     g_tamano = 0;
 
-    Unordered_Map<uint32_t, Reserva>* Reservas = nullptr;
-    Unordered_Map<uint32_t, Alojamiento>* Alojamientos = nullptr;
-    Unordered_Map<uint64_t, Anfitrion>* Anfitriones = nullptr;
+    Mapa_Reservas* Reservas = nullptr;
+    Mapa_Alojamientos* Alojamientos = nullptr;
+    Mapa_Anfitriones* Anfitriones = nullptr;
+    //Los textos de alojamientos y reservas de la sesión; se liberan juntos al salir
+    Arena_Cadenas arena;
 
     size_t num_reservas = 0;
     bool update_reservas = false;
@@ -1641,7 +1709,7 @@ void zona_huesped(Fecha *fecha_sistema)
         g_ciclos = 0;
         return;
     }
-    Alojamientos = cargar_alojamientos_completos(ALOJAMIENTO_FILE, Anfitriones, num_reservas);
+    Alojamientos = cargar_alojamientos_completos(ALOJAMIENTO_FILE, Anfitriones, &arena, num_reservas);
     if (Alojamientos == nullptr) {
         std::cerr << "Error al cargar los alojamientos." << std::endl;
         imprimir_contadores("Cargar alojamientos");
@@ -1652,7 +1720,7 @@ void zona_huesped(Fecha *fecha_sistema)
         delete Anfitriones;
         return;
     }
-    Reservas = leer_reservas(RESERVAS_FILE, Alojamientos, huesped_user, num_reservas, codigo_reserva);
+    Reservas = leer_reservas(RESERVAS_FILE, Alojamientos, huesped_user, nullptr, &arena, num_reservas, codigo_reserva);
     if (Reservas == nullptr) {
         std::cerr << "Error al cargar las reservas." << std::endl;
         imprimir_contadores("Cargar reservas");
@@ -1665,9 +1733,14 @@ void zona_huesped(Fecha *fecha_sistema)
         delete Anfitriones;
         return;
     }
-    g_tamano += (Anfitriones->info_map() + Alojamientos->info_map() + Reservas->info_map());
+    iniciar_calendarios(Alojamientos, fecha_sistema);
+    Indice_Municipios municipios(Alojamientos->size() / ALOJAMIENTOS_MUNICIPIO + 1);
+    indexar_municipios(Alojamientos, &municipios);
+    //Las tablas de los mapas ya se contaron al reservarlas; falta el objeto de cada mapa
+    g_tamano += sizeof(*Anfitriones) + sizeof(*Alojamientos) + sizeof(*Reservas) + municipios.get_bytes();
 
     imprimir_contadores("Cargar datos");
+    imprimir_estadisticas_mapas(Anfitriones, Alojamientos, Reservas);
     std::cout << "Se hicieron: " << g_ciclos << " ciclos para cargar los datos en memoria" << std::endl;
     std::cout << "Los objetos creados ocupan: " << g_tamano << " bytes" << std::endl;
     g_ciclos = 0;
@@ -1684,11 +1757,11 @@ void zona_huesped(Fecha *fecha_sistema)
         opc = opc - '0'; // Convertir al numerito :)
         switch (opc) {
             case 1:
-                opcion_anular_reservacion_huesped(Alojamientos, Reservas, huesped_user, 
+                opcion_anular_reservacion_huesped(Reservas, huesped_user, 
                                                 num_reservas, update_reservas);            
                 break;
             case 2:
-                opcion_agregar_reserva(Alojamientos, Reservas, Anfitriones, fecha_sistema, huesped_user, 
+                opcion_agregar_reserva(Alojamientos, Reservas, &arena, &municipios, Anfitriones, fecha_sistema, huesped_user, 
                                     codigo_reserva, num_reservas, update_reservas);
                 break;
             case 3:
@@ -1734,10 +1807,10 @@ void zona_huesped(Fecha *fecha_sistema)
 
 void app_main() 
 {
-    Fecha *fecha_sistema = new Fecha();
+    Fecha fecha_sistema;
     char fecha[LONG_FECHA_CADENA + 1] = {0};
     obtener_fecha_actual(fecha, LONG_FECHA_CADENA + 1);
-    fecha_sistema->cargar_desde_cadena(fecha);
+    fecha_sistema.cargar_desde_cadena(fecha);
     imprimir_contadores("Cargar fecha del sistema");
     uint8_t opc = 0;
     
@@ -1752,11 +1825,11 @@ void app_main()
         switch (opc) {
         case 1:
             std::cout << "Bienvenido Huesped" << std::endl;
-            zona_huesped(fecha_sistema);
+            zona_huesped(&fecha_sistema);
             break;
         case 2:
             std::cout << "Bienvenido Anfitrion" << std::endl;
-            zona_anfitrion(fecha_sistema);
+            zona_anfitrion(&fecha_sistema);
             break;
         case 3:
             std::cout << "Saliendo..." << std::endl;
@@ -1766,5 +1839,4 @@ void app_main()
             break;
         }
     } while (opc != 3);
-    delete fecha_sistema;
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "arena_cadenas.hpp"
+#include <cstring>
+#include <new>
+#include "performance.hpp"
+
+Cadena::Cadena() : m_datos(nullptr), m_longitud(0) {}
+
+Cadena::Cadena(const char *datos, uint32_t longitud) : m_datos(datos), m_longitud(longitud) {}
+
+const char *Cadena::c_str() const
+{
+    return m_datos;
+}
+
+uint32_t Cadena::size() const
+{
+    return m_longitud;
+}
+
+Arena_Cadenas::Arena_Cadenas()
+    : m_bloques(nullptr), m_libre(nullptr), m_fin(nullptr), m_bytes(0), m_usados(0) {}
+
+Arena_Cadenas::~Arena_Cadenas()
+{
+    reset();
+}
+
+char *Arena_Cadenas::nuevo_bloque(size_t capacidad)
+{
+    Bloque *bloque = static_cast<Bloque*>(::operator new(sizeof(Bloque) + capacidad));
+    bloque->siguiente = m_bloques;
+    m_bloques = bloque;
+    m_bytes += sizeof(Bloque) + capacidad;
+    return reinterpret_cast<char*>(bloque + 1);
+}
+
+/**
+ * @brief Avanza el puntero libre del bloque actual. Si no cabe, las cadenas grandes van en un
+ *        bloque propio (el bloque actual sigue en uso) y las demás abren un bloque nuevo.
+ */
+Cadena Arena_Cadenas::copiar(const char *texto, size_t longitud)
+{
+    size_t necesarios = longitud + 1;
+    char *destino;
+
+    if (necesarios <= static_cast<size_t>(m_fin - m_libre)) {
+        destino = m_libre;
+        m_libre += necesarios;
+    } else if (necesarios >= CADENA_GRANDE_ARENA) {
+        destino = nuevo_bloque(necesarios);
+    } else {
+        destino = nuevo_bloque(TAM_BLOQUE_ARENA);
+        m_libre = destino + necesarios;
+        m_fin = destino + TAM_BLOQUE_ARENA;
+    }
+
+    std::memcpy(destino, texto, longitud);
+    destino[longitud] = '\0';
+    g_memcpy_cnt++;
+    m_usados += necesarios;
+    return Cadena(destino, static_cast<uint32_t>(longitud));
+}
+
+Cadena Arena_Cadenas::copiar(const char *texto)
+{
+    if (texto == nullptr)
+        return Cadena();
+
+    g_strlen_cnt++;
+    return copiar(texto, std::strlen(texto));
+}
+
+/**
+ * @brief Libera los bloques recorriendo solo su lista, sin importar cuántas cadenas tengan.
+ */
+void Arena_Cadenas::reset()
+{
+    while (m_bloques != nullptr) {
+        Bloque *siguiente = m_bloques->siguiente;
+        ::operator delete(m_bloques);
+        m_bloques = siguiente;
+        g_ciclos++;
+    }
+
+    m_libre = nullptr;
+    m_fin = nullptr;
+    m_bytes = 0;
+    m_usados = 0;
+}
+
+size_t Arena_Cadenas::get_bytes() const
+{
+    return m_bytes;
+}
+
+size_t Arena_Cadenas::get_usados() const
+{
+    return m_usados;
+}
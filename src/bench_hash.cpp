@@ -0,0 +1,121 @@
+/**
+ * @file bench_hash.cpp
+ * @brief Compara la política de hash de los documentos (Fibonacci) con el djb2 anterior.
+ *
+ * Lee los documentos de anfitriones.txt y huespedes.txt (o de los archivos pasados como
+ * argumentos), mide el tiempo de hashearlos repetidas veces con cada política y los inserta en
+ * un Unordered_Map con cada una para comparar las distancias de sondeo que produce la máscara.
+ *
+ * Uso: bench_hash [anfitriones.txt] [huespedes.txt]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "hash_policy.hpp"
+#include "unordered_map.hpp"
+#include "small_vector.hpp"
+#include "app.hpp"
+
+#define HASHES_POR_POLITICA 20000000 // Hashes que se miden con cada política
+#define DOCUMENTOS_LOCALES 64 // Documentos que caben sin pedir memoria
+
+/**
+ * @brief djb2 sobre los 8 bytes del documento, como hacía Hash_Policy<uint64_t> antes de la
+ *        política para enteros.
+ */
+struct Hash_Djb2 {
+    static size_t hash(const uint64_t& key)
+    {
+        size_t hash_value = 5381;
+        const uint8_t* key_bytes = reinterpret_cast<const uint8_t*>(&key);
+        for (size_t i = 0; i < sizeof(key); ++i, g_ciclos++)
+            hash_value = ((hash_value << 5) + hash_value) + key_bytes[i];
+        return hash_value;
+    }
+
+    static bool equal(const uint64_t& a, const uint64_t& b)
+    {
+        return a == b;
+    }
+};
+
+typedef Small_Vector<uint64_t, DOCUMENTOS_LOCALES> Lista_Documentos;
+
+/**
+ * @brief Agrega el primer campo de cada línea (el documento) de un archivo de usuarios.
+ *        La primera línea del archivo es la cantidad de registros y se salta.
+ */
+static bool leer_documentos(const char *filename, Lista_Documentos &documentos)
+{
+    std::ifstream archivo(filename);
+    if (!archivo.is_open()) {
+        std::cerr << "No se pudo abrir " << filename << std::endl;
+        return false;
+    }
+
+    std::string linea;
+    std::getline(archivo, linea);
+    while (std::getline(archivo, linea)) {
+        uint64_t documento = std::strtoull(linea.c_str(), nullptr, 10);
+        if (documento != 0)
+            documentos.push_back(documento);
+    }
+    return true;
+}
+
+/**
+ * @brief Mide el hash de todos los documentos hasta sumar HASHES_POR_POLITICA y arma un mapa
+ *        con ellos para reportar sus distancias de sondeo.
+ *
+ * Un documento puede repetirse (alguien que es anfitrión y huésped, o el mismo archivo dos
+ * veces); solo se inserta la primera vez, porque insert() sobre una clave existente libera el
+ * valor anterior y estos apuntan a la lista, no a memoria propia del mapa.
+ */
+template <typename Hash>
+static void medir(const char *nombre, Lista_Documentos &documentos)
+{
+    size_t vueltas = HASHES_POR_POLITICA / documentos.get_size() + 1;
+    size_t acumulado = 0;
+
+    auto inicio = std::chrono::steady_clock::now();
+    for (size_t v = 0; v < vueltas; ++v) {
+        for (uint64_t documento : documentos) {
+            // El xor con v impide que el compilador saque el hash del ciclo
+            acumulado += Hash::hash(documento ^ v);
+        }
+    }
+    auto fin = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(fin - inicio).count() /
+                static_cast<double>(vueltas * documentos.get_size());
+
+    Unordered_Map<uint64_t, uint64_t, Hash> mapa(documentos.get_size());
+    for (uint64_t &documento : documentos) {
+        if (mapa.find(documento) == nullptr)
+            mapa.insert(documento, &documento);
+    }
+
+    std::cout << nombre << ": " << ns << " ns por hash (control " << (acumulado & 0xFF) << ")" << std::endl;
+    std::cout << nombre << ": " << mapa.size() << " claves distintas en el mapa" << std::endl;
+    mapa.imprimir_estadisticas(nombre);
+}
+
+int main(int argc, char *argv[])
+{
+    Lista_Documentos documentos;
+    if (!leer_documentos(argc > 1 ? argv[1] : ANFITRION_FILE, documentos) ||
+        !leer_documentos(argc > 2 ? argv[2] : HUESPED_FILE, documentos))
+        return 1;
+
+    if (documentos.is_empty()) {
+        std::cerr << "No se encontraron documentos" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Documentos: " << documentos.get_size() << std::endl;
+    medir<Hash_Policy<uint64_t>>("fibonacci", documentos);
+    medir<Hash_Djb2>("djb2", documentos);
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "calendario_ocupacion.hpp"
+#include <cstring>
+#include "performance.hpp"
+
+Calendario_Ocupacion::Calendario_Ocupacion() : m_bits{}, m_dia_base(0), m_activo(false) {}
+
+void Calendario_Ocupacion::iniciar(const Fecha &base)
+{
+    std::memset(m_bits, 0, sizeof(m_bits));
+    m_dia_base = base.get_dia_serial();
+    m_activo = true;
+}
+
+bool Calendario_Ocupacion::cubre(const Fecha &desde, const Fecha &hasta) const
+{
+    return m_activo && desde.get_dia_serial() >= m_dia_base &&
+           hasta.get_dia_serial() <= m_dia_base + DIAS_CALENDARIO;
+}
+
+bool Calendario_Ocupacion::recortar(const Fecha &desde, const Fecha &hasta, int32_t &inicio, int32_t &fin) const
+{
+    if (!m_activo)
+        return false;
+
+    inicio = desde.get_dia_serial() - m_dia_base;
+    fin = hasta.get_dia_serial() - m_dia_base;
+    if (inicio < 0)
+        inicio = 0;
+    if (fin > DIAS_CALENDARIO)
+        fin = DIAS_CALENDARIO;
+    return inicio < fin;
+}
+
+/**
+ * @brief Los bits de la palabra van de palabra * 64 a palabra * 64 + 63; se recortan a [inicio, fin).
+ */
+uint64_t Calendario_Ocupacion::mascara(uint32_t palabra, int32_t inicio, int32_t fin)
+{
+    int32_t primero = static_cast<int32_t>(palabra) * BITS_PALABRA_CALENDARIO;
+    int32_t desde = inicio > primero ? inicio - primero : 0;
+    int32_t hasta = fin - primero < BITS_PALABRA_CALENDARIO ? fin - primero : BITS_PALABRA_CALENDARIO;
+
+    uint64_t alta = hasta == BITS_PALABRA_CALENDARIO ? ~0ULL : (1ULL << hasta) - 1;
+    return alta & (~0ULL << desde);
+}
+
+void Calendario_Ocupacion::marcar(const Fecha &desde, const Fecha &hasta)
+{
+    int32_t inicio, fin;
+    if (!recortar(desde, hasta, inicio, fin))
+        return;
+
+    for (uint32_t p = inicio / BITS_PALABRA_CALENDARIO; p <= static_cast<uint32_t>(fin - 1) / BITS_PALABRA_CALENDARIO; ++p, g_ciclos++)
+        m_bits[p] |= mascara(p, inicio, fin);
+}
+
+void Calendario_Ocupacion::liberar(const Fecha &desde, const Fecha &hasta)
+{
+    int32_t inicio, fin;
+    if (!recortar(desde, hasta, inicio, fin))
+        return;
+
+    for (uint32_t p = inicio / BITS_PALABRA_CALENDARIO; p <= static_cast<uint32_t>(fin - 1) / BITS_PALABRA_CALENDARIO; ++p, g_ciclos++)
+        m_bits[p] &= ~mascara(p, inicio, fin);
+}
+
+bool Calendario_Ocupacion::libre(const Fecha &desde, const Fecha &hasta) const
+{
+    int32_t inicio, fin;
+    if (!recortar(desde, hasta, inicio, fin))
+        return true;
+
+    for (uint32_t p = inicio / BITS_PALABRA_CALENDARIO; p <= static_cast<uint32_t>(fin - 1) / BITS_PALABRA_CALENDARIO; ++p, g_ciclos++) {
+        if (m_bits[p] & mascara(p, inicio, fin))
+            return false;
+    }
+    return true;
+}
@@ -1,16 +1,130 @@
 #include "fecha.hpp"
-#include <cstdio>
-#include <cctype>
 #include <cstring>
 #include <iostream>
+#include <bit>
 #include "performance.hpp"
+#include "formato.hpp"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#define ANIOS_TABLA (ANIO_TABLA_MAX - ANIO_TABLA_MIN + 1) // Años cubiertos por la tabla de calendario
+#define DIAS_ANIO_BISIESTO 366                             // Días de un año bisiesto
+#define DIA_29_FEBRERO 59                                   // Día del año (desde 0) del 29 de febrero
+
 /**
- * @brief Clase para manejar fechas con validación y operaciones básicas.
+ * @brief Días transcurridos antes de cada mes, para año común [0] y bisiesto [1].
+ * La posición CANT_MESES es el total de días del año.
+ */
+static constexpr uint16_t DIAS_ACUMULADOS[2][CANT_MESES + 1] = {
+    {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},
+    {0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366}
+};
+
+/**
+ * @brief Tabla de calendario para los años entre ANIO_TABLA_MIN y ANIO_TABLA_MAX.
+ */
+struct Tabla_Calendario {
+    int32_t inicio_anio[ANIOS_TABLA + 1];   ///< Día serial del 1 de enero de cada año (y del año siguiente al último).
+    bool bisiesto[ANIOS_TABLA];             ///< Indica si cada año es bisiesto.
+    uint8_t mes_del_dia[DIAS_ANIO_BISIESTO]; ///< Mes (1-12) de cada día del año en un año bisiesto.
+};
+
+static constexpr bool calcular_bisiesto(int32_t anio)
+{
+    return (anio % 4 == 0 && anio % 100 != 0) || (anio % 400 == 0);
+}
+
+/**
+ * @brief Construye la tabla de calendario en tiempo de compilación.
+ * El 01/01/1900 está 25567 días antes de la época; de ahí se acumulan los largos de cada año.
  */
-Fecha::Fecha() : dia(DIA_DEFECTO), mes(MES_DEFECTO), anio(ANIO_DEFECTO) {
-    g_tamano += sizeof(Fecha);
+static constexpr Tabla_Calendario construir_tabla_calendario()
+{
+    Tabla_Calendario tabla{};
+    int32_t inicio = -25567;
+
+    for (int32_t i = 0; i < ANIOS_TABLA; ++i) {
+        tabla.bisiesto[i] = calcular_bisiesto(ANIO_TABLA_MIN + i);
+        tabla.inicio_anio[i] = inicio;
+        inicio += DIAS_ACUMULADOS[tabla.bisiesto[i]][CANT_MESES];
+    }
+    tabla.inicio_anio[ANIOS_TABLA] = inicio;
+
+    for (uint8_t mes = 1; mes <= CANT_MESES; ++mes)
+        for (uint16_t dia = DIAS_ACUMULADOS[1][mes - 1]; dia < DIAS_ACUMULADOS[1][mes]; ++dia)
+            tabla.mes_del_dia[dia] = mes;
+
+    return tabla;
 }
 
+static constexpr Tabla_Calendario CALENDARIO = construir_tabla_calendario();
+
+static_assert(CALENDARIO.inicio_anio[1970 - ANIO_TABLA_MIN] == 0, "El 01/01/1970 debe ser el día serial 0");
+
+#define PATRON_CABEZA 0x30302F30302F3030ULL // "dd/mm/aa" en little endian: '0' en dígitos, '/' en separadores
+#define LIMITE_CABEZA 0x0909000909000909ULL // Valor máximo de cada byte de la cabeza tras quitarle el patrón
+#define SUMA_CABEZA 0x76767F76767F7676ULL   // 0x7F - límite: lleva al bit alto todo byte que pase su límite
+#define PATRON_COLA 0x3030                  // "aa" final del año
+#define SUMA_COLA 0x7676                    // 0x7F - 9 para los dos dígitos de la cola
+#define BITS_ALTOS_CABEZA 0x8080808080808080ULL // Bit alto de cada byte de la cabeza
+#define BITS_ALTOS_COLA 0x8080                  // Bit alto de cada byte de la cola
+
+static_assert(std::endian::native == std::endian::little, "El lector de fechas asume bytes en little endian");
+
+/**
+ * @brief Carga los 10 bytes de "dd/mm/aaaa" en dos registros: los 8 primeros y los 2 del final del año.
+ * strnlen no lee más allá del byte 11, así que las lecturas de 8 y 2 bytes quedan dentro de la cadena.
+ * @return false si la cadena no tiene exactamente LONG_FECHA_CADENA caracteres.
+ */
+static bool cargar_bytes_fecha(const char *cadena, uint64_t &cabeza, uint16_t &cola)
+{
+    g_strlen_cnt++;
+    if (!cadena || strnlen(cadena, LONG_FECHA_CADENA + 1) != LONG_FECHA_CADENA)
+        return false;
+
+    std::memcpy(&cabeza, cadena, sizeof(cabeza));
+    std::memcpy(&cola, cadena + sizeof(cabeza), sizeof(cola));
+    cabeza ^= PATRON_CABEZA;
+    cola ^= PATRON_COLA;
+    return true;
+}
+
+/**
+ * @brief Valida a la vez los 10 bytes ya sin patrón: dígitos en [0, 9] y separadores en 0.
+ * Sumar 0x7F - límite deja el bit alto encendido solo en los bytes que pasan su límite; un byte
+ * que ya lo traía encendido queda marcado por el OR. Un acarreo solo sale de un byte ya inválido.
+ */
+static bool cabeza_valida(uint64_t cabeza)
+{
+    return (((cabeza + SUMA_CABEZA) | cabeza) & BITS_ALTOS_CABEZA) == 0;
+}
+
+static bool cola_valida(uint16_t cola)
+{
+    return ((static_cast<uint16_t>(cola + SUMA_COLA) | cola) & BITS_ALTOS_COLA) == 0;
+}
+
+/**
+ * @brief Convierte los dígitos ya validados con multiplicar y desplazar.
+ * cabeza * 10 + (cabeza >> 8) deja en cada byte su dígito por 10 más el del byte siguiente; como
+ * cada dígito es a lo sumo 9, ningún byte pasa de 99 y no hay acarreos entre bytes. El día queda
+ * en el byte 0, el mes en el 3 y los dos primeros dígitos del año en el 6.
+ */
+static void convertir_bytes_fecha(uint64_t cabeza, uint16_t cola, uint8_t &d, uint8_t &m, int16_t &a)
+{
+    uint64_t pares = cabeza * 10 + (cabeza >> 8);
+    d = static_cast<uint8_t>(pares);
+    m = static_cast<uint8_t>(pares >> 24);
+    a = static_cast<int16_t>(static_cast<uint8_t>(pares >> 48) * 100 + (cola & 0xFF) * 10 + (cola >> 8));
+}
+
+/**
+ * @brief Clase para manejar fechas con validación y operaciones básicas.
+ */
+Fecha::Fecha() : serial(dias_desde_civil(DIA_DEFECTO, MES_DEFECTO, ANIO_DEFECTO)) {}
+
 /**
  * @brief Constructor con parámetros, valida la fecha y asigna valores.
  *        Si la fecha es inválida, asigna la fecha por defecto.
@@ -21,11 +135,79 @@ Fecha::Fecha() : dia(DIA_DEFECTO), mes(MES_DEFECTO), anio(ANIO_DEFECTO) {
  */
 Fecha::Fecha(uint8_t d, uint8_t m, int16_t a) 
 {
-    if (!set_fecha(d, m, a)) {
-        dia = DIA_DEFECTO;
-        mes = MES_DEFECTO;
-        anio = ANIO_DEFECTO;
+    if (!set_fecha(d, m, a))
+        serial = dias_desde_civil(DIA_DEFECTO, MES_DEFECTO, ANIO_DEFECTO);
+}
+
+Fecha Fecha::desde_dia_serial(int32_t dia)
+{
+    Fecha fecha;
+    fecha.serial = dia;
+    return fecha;
+}
+
+int32_t Fecha::get_dia_serial() const
+{
+    return serial;
+}
+
+/**
+ * @brief Días desde el 01/01/1970.
+ *
+ * Dentro de la tabla de calendario es una suma de dos búsquedas. Fuera de ella usa el
+ * algoritmo days_from_civil de H. Hinnant: cuenta los años desde marzo, para que el día
+ * bisiesto quede al final del año, y agrupa los años en eras de 400 años, que siempre
+ * tienen 146097 días.
+ */
+int32_t Fecha::dias_desde_civil(uint8_t d, uint8_t m, int16_t a)
+{
+    if (a >= ANIO_TABLA_MIN && a <= ANIO_TABLA_MAX) {
+        int32_t i = a - ANIO_TABLA_MIN;
+        return CALENDARIO.inicio_anio[i] + DIAS_ACUMULADOS[CALENDARIO.bisiesto[i]][m - 1] + d - 1;
+    }
+
+    int32_t y = a - (m <= 2);
+    int32_t era = (y >= 0 ? y : y - 399) / 400;
+    int32_t anio_era = y - era * 400;                                // [0, 399]
+    int32_t dia_anio = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1; // [0, 365]
+    int32_t dia_era = anio_era * 365 + anio_era / 4 - anio_era / 100 + dia_anio; // [0, 146096]
+    return era * 146097 + dia_era - 719468;
+}
+
+/**
+ * @brief Inversa de dias_desde_civil.
+ *
+ * Dentro de la tabla, dividir entre 366 da el año o uno antes (en 301 años el error
+ * acumulado es menor a un año), así que basta con avanzar a lo sumo un año. El mes sale
+ * de la tabla de días de un año bisiesto; en años comunes, desde el 1 de marzo se corre un día.
+ * Fuera de la tabla usa el algoritmo civil_from_days de H. Hinnant.
+ */
+void Fecha::civil_desde_dias(int32_t dias, uint8_t &d, uint8_t &m, int16_t &a)
+{
+    if (dias >= CALENDARIO.inicio_anio[0] && dias < CALENDARIO.inicio_anio[ANIOS_TABLA]) {
+        int32_t i = (dias - CALENDARIO.inicio_anio[0]) / DIAS_ANIO_BISIESTO;
+        if (dias >= CALENDARIO.inicio_anio[i + 1])
+            i++;
+
+        int32_t dia_anio = dias - CALENDARIO.inicio_anio[i];
+        if (!CALENDARIO.bisiesto[i] && dia_anio >= DIA_29_FEBRERO)
+            dia_anio++;
+
+        m = CALENDARIO.mes_del_dia[dia_anio];
+        d = static_cast<uint8_t>(dia_anio - DIAS_ACUMULADOS[1][m - 1] + 1);
+        a = static_cast<int16_t>(ANIO_TABLA_MIN + i);
+        return;
     }
+
+    dias += 719468;
+    int32_t era = (dias >= 0 ? dias : dias - 146096) / 146097;
+    int32_t dia_era = dias - era * 146097;                                                // [0, 146096]
+    int32_t anio_era = (dia_era - dia_era / 1460 + dia_era / 36524 - dia_era / 146096) / 365; // [0, 399]
+    int32_t dia_anio = dia_era - (365 * anio_era + anio_era / 4 - anio_era / 100);        // [0, 365]
+    int32_t mp = (5 * dia_anio + 2) / 153;                                                // [0, 11]
+    d = static_cast<uint8_t>(dia_anio - (153 * mp + 2) / 5 + 1);
+    m = static_cast<uint8_t>(mp < 10 ? mp + 3 : mp - 9);
+    a = static_cast<int16_t>(anio_era + era * 400 + (m <= 2));
 }
 
 /**
@@ -37,7 +219,9 @@ Fecha::Fecha(uint8_t d, uint8_t m, int16_t a)
  */
 bool Fecha::es_bisiesto(int16_t anio) const 
 {
-    return (anio % 4 == 0 && anio % 100 != 0) || (anio % 400 == 0);
+    if (anio >= ANIO_TABLA_MIN && anio <= ANIO_TABLA_MAX)
+        return CALENDARIO.bisiesto[anio - ANIO_TABLA_MIN];
+    return calcular_bisiesto(anio);
 }
 
 /**
@@ -49,13 +233,8 @@ bool Fecha::es_bisiesto(int16_t anio) const
  */
 uint8_t Fecha::dias_en_mes(uint8_t mes, int16_t anio) const 
 {
-    static const uint8_t dias_por_mes[CANT_MESES + 1] = {
-        0, 31, 28, 31, 30, 31, 30,
-        31, 31, 30, 31, 30, 31
-    };
-    if (mes == 2 && es_bisiesto(anio))
-        return 29;
-    return dias_por_mes[mes];
+    const uint16_t *acumulados = DIAS_ACUMULADOS[es_bisiesto(anio)];
+    return static_cast<uint8_t>(acumulados[mes] - acumulados[mes - 1]);
 }
 
 /**
@@ -71,9 +250,7 @@ bool Fecha::set_fecha(uint8_t d, uint8_t m, int16_t a)
 {
     if (a < ANIO_MIN || m < MES_MIN || m > MES_MAX || d < DIA_MIN || d > dias_en_mes(m, a))
         return false;
-    dia = d;
-    mes = m;
-    anio = a;
+    serial = dias_desde_civil(d, m, a);
     return true;
 }
 
@@ -86,30 +263,84 @@ bool Fecha::set_fecha(uint8_t d, uint8_t m, int16_t a)
  */
 bool Fecha::cargar_desde_cadena(const char* cadena) 
 {
-    g_strlen_cnt++;
-    if (!cadena || std::strlen(cadena) != LONG_FECHA_CADENA) {
+    uint64_t cabeza;
+    uint16_t cola;
+    if (!cargar_bytes_fecha(cadena, cabeza, cola) || !cabeza_valida(cabeza) || !cola_valida(cola))
         return false;
-    }
-        
-    for (int i = 0; i < LONG_FECHA_CADENA; ++i) {
-        if (i == 2 || i == 5) {
-            if (cadena[i] != '/') 
-                return false;
-        } else {
-            g_is_digit_cnt++;
-            if (!std::isdigit(cadena[i])) {
-                return false;
-            }
+
+    uint8_t d, m;
+    int16_t a;
+    convertir_bytes_fecha(cabeza, cola, d, m, a);
+    return set_fecha(d, m, a);
+}
+
+/**
+ * @brief Carga varias fechas a la vez.
+ *
+ * Las cabezas "dd/mm/aa" de varias fechas se validan juntas en un registro vectorial: cuatro por
+ * registro con AVX2 y dos con SSE2. Un byte es válido si max(byte, límite) == límite. Las fechas
+ * que sobran, o todas si no hay instrucciones vectoriales, se validan con las máscaras escalares.
+ * SSE2 siempre está en x86-64; la rama AVX2 solo se compila con la opción FECHA_AVX2 de CMake.
+ */
+uint32_t Fecha::cargar_lote(const char *const *cadenas, Fecha *fechas, uint32_t n)
+{
+    uint64_t cabezas[LOTE_FECHAS];
+    uint16_t colas[LOTE_FECHAS];
+    uint32_t validas = 0;
+
+    for (uint32_t inicio = 0; inicio < n; inicio += LOTE_FECHAS) {
+        uint32_t tam = (n - inicio < LOTE_FECHAS) ? n - inicio : LOTE_FECHAS;
+        uint32_t leidas = 0;  //Bit i encendido si la fecha i tiene el largo correcto
+        uint32_t cabezas_ok = 0; //Bit i encendido si la cabeza de la fecha i es válida
+        uint32_t i = 0;
+
+        for (uint32_t j = 0; j < tam; ++j, g_ciclos++) {
+            if (cargar_bytes_fecha(cadenas[inicio + j], cabezas[j], colas[j]))
+                leidas |= 1u << j;
+            else
+                cabezas[j] = ~0ULL;
         }
-        g_ciclos++;
-    }
 
-    uint8_t d = (cadena[0] - '0') * 10 + (cadena[1] - '0');
-    uint8_t m = (cadena[3] - '0') * 10 + (cadena[4] - '0');
-    int16_t a = (cadena[6] - '0') * 1000 + (cadena[7] - '0') * 100 +
-                (cadena[8] - '0') * 10 + (cadena[9] - '0');
+#if defined(__AVX2__)
+        const __m256i limite4 = _mm256_set1_epi64x(static_cast<long long>(LIMITE_CABEZA));
+        for (; i + 4 <= tam; i += 4) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cabezas + i));
+            __m256i ok = _mm256_cmpeq_epi8(_mm256_max_epu8(v, limite4), limite4);
+            uint32_t bytes_ok = static_cast<uint32_t>(_mm256_movemask_epi8(ok));
+            for (uint32_t k = 0; k < 4; ++k)
+                if (((bytes_ok >> (8 * k)) & 0xFF) == 0xFF)
+                    cabezas_ok |= 1u << (i + k);
+        }
+#endif
+#if defined(__SSE2__)
+        const __m128i limite2 = _mm_set1_epi64x(static_cast<long long>(LIMITE_CABEZA));
+        for (; i + 2 <= tam; i += 2) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cabezas + i));
+            __m128i ok = _mm_cmpeq_epi8(_mm_max_epu8(v, limite2), limite2);
+            uint32_t bytes_ok = static_cast<uint32_t>(_mm_movemask_epi8(ok));
+            if ((bytes_ok & 0xFF) == 0xFF)
+                cabezas_ok |= 1u << i;
+            if ((bytes_ok >> 8) == 0xFF)
+                cabezas_ok |= 1u << (i + 1);
+        }
+#endif
+        for (; i < tam; ++i)
+            if (cabeza_valida(cabezas[i]))
+                cabezas_ok |= 1u << i;
 
-    return set_fecha(d, m, a);
+        for (uint32_t j = 0; j < tam; ++j) {
+            if (!((leidas & cabezas_ok) >> j & 1u) || !cola_valida(colas[j]))
+                continue;
+
+            uint8_t d, m;
+            int16_t a;
+            convertir_bytes_fecha(cabezas[j], colas[j], d, m, a);
+            if (fechas[inicio + j].set_fecha(d, m, a))
+                validas++;
+        }
+    }
+
+    return validas;
 }
 
 /**
@@ -121,8 +352,10 @@ bool Fecha::cargar_desde_cadena(const char* cadena)
  */
 char *Fecha::a_cadena(char* destino) const 
 {
-    std::sprintf(destino, "%02u/%02u/%04d", dia, mes, anio);
-    g_sprintf_cnt++;
+    uint8_t dia, mes;
+    int16_t anio;
+    civil_desde_dias(serial, dia, mes, anio);
+    *formato_fecha(destino, dia, mes, anio) = '\0';
     return destino;
 }
 
@@ -131,17 +364,14 @@ char *Fecha::a_cadena(char* destino) const
  * 
  * @param otra Fecha a comparar.
  * @return int Resultado de la comparación:
- *             -1 si esta fecha es menor,
+ *             negativo si esta fecha es menor,
  *              0 si son iguales,
- *              1 si esta fecha es mayor.
+ *             positivo si esta fecha es mayor.
+ *         Es la diferencia en días entre las dos fechas.
  */
 
 int32_t Fecha::comparar(const Fecha& otra) const {
-    if (anio != otra.anio)
-        return anio - otra.anio;
-    if (mes != otra.mes)
-        return mes - otra.mes;
-    return dia - otra.dia;
+    return serial - otra.serial;
 }
 
 /**
@@ -188,35 +418,14 @@ void Fecha::mostrar_fecha(const Fecha& fecha)
 }
 /**
  * @brief Suma un número dado de noches a la fecha actual, devolviendo una nueva fecha.
+ * Con el día serial es una suma: no hay que recorrer los meses.
  * 
- * @return Fecha* Puntero a una nueva instancia de Fecha con la fecha resultante.
- *               El usuario es responsable de liberar la memoria.
+ * @return Fecha resultante.
  */
-Fecha* Fecha::sumar_noches(uint16_t noches) const 
+Fecha Fecha::sumar_noches(uint16_t noches) const 
 {
-    uint8_t d = dia, m = mes;
-    int16_t a = anio;
-
-    while (noches > 0) {
-        uint8_t dias_mes_actual = dias_en_mes(m, a);
-        uint8_t restantes = dias_mes_actual - d;
-
-        if (noches <= restantes) {
-            d += noches;
-            noches = 0;
-        } else {
-            noches -= (restantes + 1);
-            d = 1;
-            if (++m > CANT_MESES) {
-                m = 1;
-                ++a;
-            }
-        }
-        g_ciclos++;
-    }   
-
-    Fecha* nueva = new Fecha();
-    nueva->set_fecha(d, m, a);
+    Fecha nueva;
+    nueva.serial = serial + noches;
     return nueva;
 }
 
@@ -224,13 +433,14 @@ Fecha* Fecha::sumar_noches(uint16_t noches) const
  * @brief Agrega años a la fecha actual y entrega una nueva fecha
  * 
  * @param anios Número de años a sumar
- * @return Fecha* Puntero a una nueva instancia de Fecha con la fecha resultante.
- *               El usuario es responsable de liberar la memoria.
+ * @return Fecha resultante.
  */
-Fecha* Fecha::agregar_anios(uint8_t anios) const 
+Fecha Fecha::agregar_anios(uint8_t anios) const 
 {
-    Fecha *nueva_fecha = new Fecha(dia, mes, anio + anios);
-    return nueva_fecha;
+    uint8_t dia, mes;
+    int16_t anio;
+    civil_desde_dias(serial, dia, mes, anio);
+    return Fecha(dia, mes, anio + anios);
 }
 
 /**
@@ -256,37 +466,18 @@ void Fecha::formato_legible() const {
         "julio", "agosto", "septiembre", "octubre", "noviembre", "diciembre"
     };
 
+    uint8_t dia, mes;
+    int16_t anio;
+    civil_desde_dias(serial, dia, mes, anio);
     uint8_t dia_semana = this->dia_semana();
     std::cout << NOMBRES_DIA[dia_semana] << ", " << (int)dia << " de "
               << NOMBRES_MES[mes - 1] << " del " << anio << std::endl;
 
 }
 /**
- * @brief dia de la semana con formula de Zeller
+ * @brief Día de la semana a partir del día serial: el 01/01/1970 fue jueves.
  */
 uint8_t Fecha::dia_semana() const {
-    uint8_t d = dia;
-    uint8_t m = mes;
-    uint16_t y = anio;
-
-    if (m < 3) {
-        m += 12;
-        y -= 1;
-    }
-
-    uint16_t k = y % 100;
-    uint16_t j = y / 100;
-
-    uint16_t h = (d + 13*(m + 1)/5 + k + k/4 + j/4 + 5*j) % 7;
-    return (h + 6) % 7;
+    int32_t h = (serial + DIA_SEMANA_EPOCA) % 7;
+    return static_cast<uint8_t>(h < 0 ? h + 7 : h);
 }
-
-/**
- * @brief Destructor de la clase Fecha.
- * 
- * No se requiere liberar memoria ya que no se usan punteros dinámicos.
- */
-Fecha::~Fecha()
-{
-    g_tamano -= this->get_size();
-}
\ No newline at end of file
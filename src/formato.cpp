@@ -0,0 +1,101 @@
+#include "formato.hpp"
+#include <charconv>
+#include <cstring>
+#include "performance.hpp"
+
+/**
+ * @brief Los números de 00 a 99 seguidos: el número n está en las posiciones 2n y 2n + 1.
+ */
+static const char DOS_DIGITOS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+char *formato_dos_digitos(char *destino, uint32_t valor)
+{
+    std::memcpy(destino, DOS_DIGITOS + 2 * valor, 2);
+    return destino + 2;
+}
+
+/**
+ * @brief El año se escribe como dos pares de dígitos, así toda la fecha son cuatro copias de la tabla.
+ */
+char *formato_fecha(char *destino, uint8_t dia, uint8_t mes, int16_t anio)
+{
+    destino = formato_dos_digitos(destino, dia);
+    *destino++ = '/';
+    destino = formato_dos_digitos(destino, mes);
+    *destino++ = '/';
+    destino = formato_dos_digitos(destino, anio / 100);
+    return formato_dos_digitos(destino, anio % 100);
+}
+
+char *formato_entero(char *destino, uint64_t valor)
+{
+    return std::to_chars(destino, destino + LONG_ENTERO_MAX, valor).ptr;
+}
+
+/**
+ * @brief El formato general con 6 cifras es el mismo "%g" que usa std::ostream por defecto,
+ *        así el archivo queda idéntico al que se escribía con el operador <<.
+ */
+char *formato_flotante(char *destino, float valor)
+{
+    return std::to_chars(destino, destino + LONG_FLOTANTE_MAX, valor,
+                         std::chars_format::general, PRECISION_FLOTANTE).ptr;
+}
+
+Escritor_Lineas::Escritor_Lineas(std::ostream &salida) : m_salida(salida), m_usados(0) {}
+
+Escritor_Lineas::~Escritor_Lineas()
+{
+    vaciar();
+}
+
+char *Escritor_Lineas::reservar(size_t n)
+{
+    if (m_usados + n > TAM_BUFFER_ESCRITOR)
+        vaciar();
+    return m_buffer + m_usados;
+}
+
+void Escritor_Lineas::confirmar(char *fin)
+{
+    m_usados = fin - m_buffer;
+}
+
+void Escritor_Lineas::escribir(const char *texto, size_t n)
+{
+    if (n > TAM_BUFFER_ESCRITOR) {
+        vaciar();
+        m_salida.write(texto, n);
+        return;
+    }
+
+    char *destino = reservar(n);
+    std::memcpy(destino, texto, n);
+    g_memcpy_cnt++;
+    confirmar(destino + n);
+}
+
+void Escritor_Lineas::escribir(char c)
+{
+    char *destino = reservar(1);
+    *destino = c;
+    confirmar(destino + 1);
+}
+
+void Escritor_Lineas::vaciar()
+{
+    if (m_usados == 0)
+        return;
+    m_salida.write(m_buffer, m_usados);
+    m_usados = 0;
+}
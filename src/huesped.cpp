@@ -12,6 +12,7 @@
  #include <string>
  #include <cstring>
  #include <iostream>
+ #include <algorithm>
  #include "performance.hpp"
 
  #define LOG_SUCCESS(fn, msg) std::cout << "[Huesped/" << fn << "]: " << msg << std::endl
@@ -41,7 +42,7 @@
        m_antiguedad(antiguedad), 
        m_puntuacion(puntuacion),
        m_password(nullptr),
-       m_reservas(nullptr)
+       m_reservas(Reserva::enlace_huesped())
  {
         if (password == nullptr) {
             LOG_ERROR("Huesped", "La contraseña es nula");
@@ -71,7 +72,6 @@
         m_nombre[len_nombre - 1] = '\0';
         memcpy(m_password, password, len);
         m_password[len - 1] = '\0';
-        m_reservas = new Linked_List<Reserva*>();
         g_strlen_cnt += 3;
         g_memcpy_cnt += 2;
  };
@@ -130,7 +130,6 @@
  { 
     size_t total_size = sizeof(*this); 
     total_size += strlen(m_password) + 1;
-    total_size += sizeof(Linked_List<Reserva*>);
     return total_size;
  }
 
@@ -148,7 +147,7 @@ bool Huesped::eliminar_reserva(Reserva* reserva)
         LOG_ERROR("eliminar_reserva", "La reserva es nula");
         return false;
     }
-    if (m_reservas->remove(reserva)) {
+    if (m_reservas.remove(reserva)) {
         LOG_SUCCESS("eliminar_reserva", "Reserva eliminada con éxito");
         return true;
     } else {
@@ -170,7 +169,7 @@ void Huesped::set_reserva(Reserva* reserva)
         LOG_ERROR("set_reserva", "La reserva es nula");
         return;
     }
-    m_reservas->insert_front(reserva);
+    m_reservas.insert_front(reserva);
 }
 
 /**
@@ -180,17 +179,11 @@ void Huesped::set_reserva(Reserva* reserva)
  * @param fecha_fin Fecha de fin del rango.
  * @return true si hay reservas en el rango, false en caso contrario.
  */
-bool Huesped::tengo_reservas(Fecha *fecha_inicio, Fecha *fecha_fin) 
+bool Huesped::tengo_reservas(const Fecha &fecha_inicio, const Fecha &fecha_fin) 
 {
-    Node<Reserva*>* current = m_reservas->get_head();
-    while (current != nullptr) {
-        Reserva* reserva = current->data;
-        if (*(reserva->get_fecha_entrada()) < *fecha_fin && *(reserva->get_fecha_salida()) > *fecha_inicio)
-            return true;
-        current = m_reservas->get_next(current);
-        g_ciclos++;
-    }
-    return false;
+    return std::any_of(m_reservas.begin(), m_reservas.end(), [&](const Reserva &reserva) {
+        return reserva.get_fecha_entrada() < fecha_fin && reserva.get_fecha_salida() > fecha_inicio;
+    });
 }
 
 /**
@@ -203,9 +196,9 @@ void Huesped::mostrar_reserva_huesped(Reserva *reserva)
     std::cout << "Nombre: " << m_nombre << std::endl;
     std::cout << "Alojamiento (ID) " << reserva->get_codigo_alojamiento() << std::endl;
     std::cout << "Fecha entrada: ";
-    reserva->get_fecha_entrada()->formato_legible();
+    reserva->get_fecha_entrada().formato_legible();
     std::cout << "Fecha salida: ";
-    reserva->get_fecha_salida()->formato_legible();
+    reserva->get_fecha_salida().formato_legible();
 
 }
 /**
@@ -218,6 +211,5 @@ Huesped::~Huesped()
     g_tamano -= get_obj_size();
     delete[] m_nombre;
     delete[] m_password;
-    delete m_reservas;
 }
  
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "indice_municipios.hpp"
+#include <cctype>
+#include <algorithm>
+#include "performance.hpp"
+
+Indice_Municipios::Indice_Municipios(size_t size) : m_grupos(size) {}
+
+std::string Indice_Municipios::normalizar(const char *texto, size_t longitud)
+{
+    size_t inicio = 0;
+    while (inicio < longitud && std::isspace(static_cast<unsigned char>(texto[inicio])))
+        inicio++;
+    while (longitud > inicio && std::isspace(static_cast<unsigned char>(texto[longitud - 1])))
+        longitud--;
+
+    std::string clave(texto + inicio, longitud - inicio);
+    for (char &c : clave) {
+        // Solo ASCII: los bytes de UTF-8 (>= 0x80) no los toca tolower en la configuración "C"
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        g_ciclos++;
+    }
+    return clave;
+}
+
+Grupo_Municipio *Indice_Municipios::grupo_de(const Alojamiento *alojamiento)
+{
+    const Cadena &municipio = alojamiento->get_municipio();
+    if (municipio.c_str() == nullptr)
+        return nullptr;
+
+    std::string clave = normalizar(municipio.c_str(), municipio.size());
+    Grupo_Municipio *grupo = m_grupos.find(clave.c_str());
+    if (grupo == nullptr)
+        grupo = m_grupos.emplace(m_claves.copiar(clave.data(), clave.size()).c_str());
+    return grupo;
+}
+
+void Indice_Municipios::agregar(Alojamiento *alojamiento)
+{
+    Grupo_Municipio *grupo = grupo_de(alojamiento);
+    if (grupo == nullptr)
+        return;
+
+    //Va después de los que cuestan lo mismo o menos; los demás se corren un lugar
+    Alojamiento **lugar = std::upper_bound(grupo->begin(), grupo->end(), alojamiento->get_precio(),
+                                           [](float precio, const Alojamiento *otro) {
+        g_ciclos++;
+        return precio < otro->get_precio();
+    });
+    uint32_t posicion = static_cast<uint32_t>(lugar - grupo->begin());
+    grupo->push_back(alojamiento);
+    std::rotate(grupo->begin() + posicion, grupo->end() - 1, grupo->end());
+}
+
+void Indice_Municipios::anexar(Alojamiento *alojamiento)
+{
+    Grupo_Municipio *grupo = grupo_de(alojamiento);
+    if (grupo != nullptr)
+        grupo->push_back(alojamiento);
+}
+
+void Indice_Municipios::ordenar()
+{
+    m_grupos.for_each([](const char*, Grupo_Municipio *grupo) {
+        std::stable_sort(grupo->begin(), grupo->end(), [](const Alojamiento *a, const Alojamiento *b) {
+            g_ciclos++;
+            return a->get_precio() < b->get_precio();
+        });
+    });
+}
+
+const Grupo_Municipio *Indice_Municipios::buscar(const std::string &municipio) const
+{
+    std::string clave = normalizar(municipio.data(), municipio.size());
+    g_c_string_cnt++;
+    return m_grupos.find(clave.c_str());
+}
+
+uint32_t Indice_Municipios::hasta_precio(const Grupo_Municipio &grupo, float precio)
+{
+    if (precio == 0.0f)
+        return grupo.get_size();
+
+    Alojamiento *const *corte = std::upper_bound(grupo.begin(), grupo.end(), precio,
+                                                 [](float maximo, const Alojamiento *alojamiento) {
+        g_ciclos++;
+        return maximo < alojamiento->get_precio();
+    });
+    return static_cast<uint32_t>(corte - grupo.begin());
+}
+
+size_t Indice_Municipios::size() const
+{
+    return m_grupos.size();
+}
+
+size_t Indice_Municipios::get_bytes() const
+{
+    return m_grupos.info_map() + m_claves.get_bytes();
+}
@@ -0,0 +1,81 @@
+#include "indice_reservas.hpp"
+#include <algorithm>
+
+Indice_Reservas::Indice_Reservas()
+    : m_intervalos(nullptr), m_size(0), m_capacidad(0), m_vigente(false) {}
+
+Indice_Reservas::~Indice_Reservas()
+{
+    delete[] m_intervalos;
+}
+
+bool Indice_Reservas::vigente() const
+{
+    return m_vigente;
+}
+
+void Indice_Reservas::invalidar()
+{
+    m_vigente = false;
+}
+
+void Indice_Reservas::reconstruir(const Intrusive_List<Reserva> &reservas)
+{
+    uint32_t n = reservas.get_size();
+    if (n > m_capacidad) {
+        delete[] m_intervalos;
+        m_intervalos = new Intervalo[n];
+        m_capacidad = n;
+    }
+
+    m_size = 0;
+    for (const Reserva &reserva : reservas) {
+        Intervalo &intervalo = m_intervalos[m_size++];
+        intervalo.entrada = reserva.get_fecha_entrada().get_dia_serial();
+        intervalo.salida = reserva.get_fecha_salida().get_dia_serial();
+        intervalo.reserva = &reserva;
+        g_ciclos++;
+    }
+
+    // Empates por código de reserva para que el orden no dependa del de la lista
+    std::sort(m_intervalos, m_intervalos + m_size, [](const Intervalo &a, const Intervalo &b) {
+        g_ciclos++;
+        if (a.entrada != b.entrada)
+            return a.entrada < b.entrada;
+        return a.reserva->get_codigo_reserva() < b.reserva->get_codigo_reserva();
+    });
+
+    int32_t max_salida = INT32_MIN;
+    for (uint32_t i = 0; i < m_size; ++i, g_ciclos++) {
+        max_salida = std::max(max_salida, m_intervalos[i].salida);
+        m_intervalos[i].max_salida = max_salida;
+    }
+    m_vigente = true;
+}
+
+/**
+ * @brief fin es la primera entrada >= hasta; inicio es la primera salida máxima > desde.
+ *        Antes de inicio ninguna reserva sale después de desde, y desde fin ninguna entra antes de hasta.
+ */
+void Indice_Reservas::buscar(int32_t desde, int32_t hasta, uint32_t &inicio, uint32_t &fin) const
+{
+    const Intervalo *primero = m_intervalos;
+    const Intervalo *ultimo = m_intervalos + m_size;
+
+    const Intervalo *limite = std::partition_point(primero, ultimo, [&](const Intervalo &intervalo) {
+        g_ciclos++;
+        return intervalo.entrada < hasta;
+    });
+    const Intervalo *comienzo = std::partition_point(primero, limite, [&](const Intervalo &intervalo) {
+        g_ciclos++;
+        return intervalo.max_salida <= desde;
+    });
+
+    inicio = static_cast<uint32_t>(comienzo - primero);
+    fin = static_cast<uint32_t>(limite - primero);
+}
+
+size_t Indice_Reservas::get_bytes() const
+{
+    return static_cast<size_t>(m_capacidad) * sizeof(*m_intervalos);
+}
@@ -0,0 +1,24 @@
+/**
+ * @file performance.cpp
+ * @brief Definición de los contadores de performance.hpp.
+ */
+
+#include "performance.hpp"
+/** Contadores por hilo para medir ciclos y tamaño de objetos en memoria */
+constinit thread_local uint32_t g_ciclos = 0; ///< Contador de ciclos
+constinit thread_local uint32_t g_tamano = 0; ///< Tamaño total de objetos en memoria
+constinit thread_local uint32_t g_strlen_cnt = 0; ///< Contador de strlen
+constinit thread_local uint32_t g_memcpy_cnt = 0; ///< Contador de memcpy
+constinit thread_local uint32_t g_memcmp_cnt = 0; ///< Contador de memcmp
+constinit thread_local uint32_t g_is_digit_cnt = 0; ///< Contador de isdigit
+constinit thread_local uint32_t g_getline_cnt = 0; ///< Contador de getline
+constinit thread_local uint32_t g_string_find_cnt = 0; ///< Contador de string::find
+constinit thread_local uint32_t g_string_substr_cnt = 0; ///< Contador de string::substr
+constinit thread_local uint32_t g_std_n_pos_cnt = 0; ///< Contador de std::npos
+constinit thread_local uint32_t g_c_string_cnt = 0; ///< Contador de c_str
+constinit thread_local uint32_t g_stoi_cnt = 0; ///< Contador de stoi
+constinit thread_local uint32_t g_stof_cnt = 0; ///< Contador de stof
+constinit thread_local uint32_t g_stoull_cnt = 0; ///< Contador de stoull
+constinit thread_local uint32_t g_strcmp_cnt = 0; ///< Contador de memcmp
+constinit thread_local uint32_t g_sprintf_cnt = 0; ///< Contador de sprintf
+constinit thread_local uint32_t g_string_legnth_cnt = 0; ///< Contador de string::length
@@ -0,0 +1,109 @@
+/**
+ * @file prueba_concurrente.cpp
+ * @brief Prueba de estrés de Concurrent_Unordered_Map con el mapa de reservas.
+ *
+ * Varios lectores buscan reservas mientras varios escritores insertan y borran otras. Se compila
+ * con -fsanitize=thread (opción PRUEBA_TSAN) para que cualquier carrera de datos haga fallar la
+ * prueba. Retorna 0 si todas las lecturas vieron la reserva correcta.
+ */
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include "concurrent_unordered_map.hpp"
+#include "arena_cadenas.hpp"
+#include "reserva.hpp"
+
+#define LECTORES_PRUEBA 4 // Hilos que solo buscan
+#define ESCRITORES_PRUEBA 2 // Hilos que insertan y borran
+#define RESERVAS_FIJAS 2000 // Reservas que nadie borra
+#define RONDAS_LECTOR 50 // Veces que cada lector recorre todos los códigos
+#define RESERVAS_ESCRITOR 5000 // Reservas que inserta cada escritor
+#define PRIMER_CODIGO_ESCRITOR 100000 // Los códigos de cada escritor empiezan en un múltiplo de este
+
+typedef Concurrent_Unordered_Map<uint32_t, Reserva> Mapa_Reservas_Concurrente;
+
+/**
+ * @brief Crea una reserva cuyo documento de huésped es igual a su código, para verificarla al leer.
+ */
+static Reserva *crear_reserva(uint32_t codigo, Arena_Cadenas *arena)
+{
+    Fecha entrada = Fecha::desde_dia_serial(static_cast<int32_t>(codigo % 365));
+    Fecha salida = entrada.sumar_noches(1);
+    return new Reserva(entrada, salida, 1, codigo, codigo % 97, codigo, 'T', entrada, 100.0f,
+                       "prueba", arena);
+}
+
+/**
+ * @brief Recorre las reservas fijas con find() y todos los códigos de los escritores con
+ *        consultar(). Las fijas no se borran, así que su puntero es seguro fuera del candado.
+ */
+static void lector(const Mapa_Reservas_Concurrente *reservas, std::atomic<uint32_t> *errores)
+{
+    for (uint32_t ronda = 0; ronda < RONDAS_LECTOR; ++ronda) {
+        for (uint32_t codigo = 1; codigo <= RESERVAS_FIJAS; ++codigo) {
+            Reserva *reserva = reservas->find(codigo);
+            if (reserva == nullptr || reserva->get_documento_huesped() != codigo)
+                errores->fetch_add(1);
+        }
+
+        for (uint32_t e = 1; e <= ESCRITORES_PRUEBA; ++e) {
+            for (uint32_t i = 0; i < RESERVAS_ESCRITOR; i += 7) {
+                uint32_t codigo = e * PRIMER_CODIGO_ESCRITOR + i;
+                reservas->consultar(codigo, [&](const Reserva &reserva) {
+                    if (reserva.get_codigo_reserva() != codigo || reserva.get_documento_huesped() != codigo)
+                        errores->fetch_add(1);
+                });
+            }
+        }
+    }
+}
+
+/**
+ * @brief Inserta sus reservas y borra una de cada dos. El valor se libera después de erase(),
+ *        cuando ningún lector puede estar dentro de consultar() con él. Cada escritor usa su
+ *        propia arena porque Arena_Cadenas no es segura entre hilos.
+ */
+static void escritor(Mapa_Reservas_Concurrente *reservas, uint32_t numero, Arena_Cadenas *arena,
+                     std::atomic<uint32_t> *errores)
+{
+    for (uint32_t i = 0; i < RESERVAS_ESCRITOR; ++i) {
+        uint32_t codigo = numero * PRIMER_CODIGO_ESCRITOR + i;
+        reservas->insert(codigo, crear_reserva(codigo, arena));
+
+        if (i % 2 == 1) {
+            Reserva *borrada = reservas->erase(codigo);
+            if (borrada == nullptr)
+                errores->fetch_add(1);
+            delete borrada;
+        }
+    }
+}
+
+int main()
+{
+    Arena_Cadenas arena;
+    Arena_Cadenas arenas_escritores[ESCRITORES_PRUEBA];
+    Mapa_Reservas_Concurrente reservas(RESERVAS_FIJAS);
+    std::atomic<uint32_t> errores(0);
+
+    for (uint32_t codigo = 1; codigo <= RESERVAS_FIJAS; ++codigo)
+        reservas.insert(codigo, crear_reserva(codigo, &arena));
+
+    std::thread hilos[LECTORES_PRUEBA + ESCRITORES_PRUEBA];
+    for (uint32_t i = 0; i < LECTORES_PRUEBA; ++i)
+        hilos[i] = std::thread(lector, &reservas, &errores);
+    for (uint32_t i = 0; i < ESCRITORES_PRUEBA; ++i)
+        hilos[LECTORES_PRUEBA + i] = std::thread(escritor, &reservas, i + 1, &arenas_escritores[i], &errores);
+    for (std::thread &hilo : hilos)
+        hilo.join();
+
+    size_t esperadas = RESERVAS_FIJAS + ESCRITORES_PRUEBA * (RESERVAS_ESCRITOR / 2);
+    if (reservas.size() != esperadas)
+        errores.fetch_add(1);
+
+    std::cout << "Reservas: " << reservas.size() << " (esperadas " << esperadas << "), errores: "
+              << errores.load() << std::endl;
+    reservas.clear_values();
+    return errores.load() == 0 ? 0 : 1;
+}
@@ -4,6 +4,7 @@
 #include "reserva.hpp"
 #include "linked_list.hpp"
 #include "fecha.hpp"
+#include "tabla_reservas.hpp"
 
 /**
  * @brief Constructor de la clase Reserva.
@@ -17,36 +18,27 @@
  * @param fecha_pago Fecha en que se realizó el pago.
  * @param monto Monto pagado en la reserva.
  * @param notas Anotaciones o comentarios que el huésped incluyó en la reserva.
- * @param activa Indica si la reserva está activa o no.
+ * @param arena Arena donde se copian las anotaciones.
  */
-Reserva::Reserva(Fecha *fecha_entrada, Fecha *fecha_salida, uint16_t duracion,
+Reserva::Reserva(const Fecha &fecha_entrada, const Fecha &fecha_salida, uint16_t duracion,
                  uint32_t cod_reserva, uint32_t cod_alojamiento,
                  uint64_t doc_huesped, char metodo_pago,
-                 Fecha *fecha_pago, float monto,
-                 const char* notas)
+                 const Fecha &fecha_pago, float monto,
+                 const char* notas, Arena_Cadenas *arena)
 
     : m_duracion(duracion), m_codigo_reserva(cod_reserva),
       m_codigo_alojamiento(cod_alojamiento), m_documento_huesped(doc_huesped),
       m_metodo_pago(metodo_pago), m_monto(monto), m_fecha_entrada(fecha_entrada), 
-      m_fecha_salida(fecha_salida), m_fecha_pago(fecha_pago), m_anotaciones(nullptr)
+      m_fecha_salida(fecha_salida), m_fecha_pago(fecha_pago), m_anotaciones(arena->copiar(notas)),
+      m_alojamiento(nullptr), m_tabla(nullptr), m_fila(0)
 {
-    if (notas != nullptr) {
-        size_t len = strlen(notas) + 1;
-        g_strlen_cnt++;
-        m_anotaciones = new char[len];
-        if (m_anotaciones != nullptr) {
-            memcpy(m_anotaciones, notas, len);
-            m_anotaciones[len - 1] = '\0';
-            g_memcpy_cnt++;
-        }
-    }
 }
 
 /**
  * @brief Obtiene la fecha de entrada de la reserva.
  * @return Cadena de caracteres con la fecha en formato dd/mm/aaaa.
  */
-const Fecha* Reserva::get_fecha_entrada() const 
+const Fecha& Reserva::get_fecha_entrada() const 
 {
     return m_fecha_entrada;
 }
@@ -79,14 +71,14 @@ void Reserva::mostrar() const
     std::cout << "Documento del huésped: " << m_documento_huesped << std::endl;
     std::cout << "Método de pago: " << ((m_metodo_pago == 'P') ? "PSE" : "T. Credito") << std::endl;
     std::cout << "Fecha de entrada: ";
-    m_fecha_entrada->formato_legible();
+    m_fecha_entrada.formato_legible();
     std::cout << "Fecha de salida: ";
-    m_fecha_salida->formato_legible();
+    m_fecha_salida.formato_legible();
     std::cout << "Duración: " << m_duracion << " noches" << std::endl;
     std::cout << "Fecha de pago: ";
-    m_fecha_pago->formato_legible();
+    m_fecha_pago.formato_legible();
     std::cout << "Monto pagado: " << m_monto << std::endl;
-    std::cout << "Anotaciones: " << (m_anotaciones ? m_anotaciones : "(Ninguna)") << std::endl;
+    std::cout << "Anotaciones: " << (m_anotaciones.c_str() ? m_anotaciones.c_str() : "(Ninguna)") << std::endl;
     std::cout << "------------*------------" << std::endl;
 }
 
@@ -121,7 +113,7 @@ char Reserva::get_metodo_pago() const
  * @brief Obtiene la fecha en que se realizó el pago.
  * @return Cadena de caracteres con la fecha en formato dd/mm/aaaa.
  */
-const Fecha* Reserva::get_fecha_pago() const 
+const Fecha& Reserva::get_fecha_pago() const 
 {
     return m_fecha_pago;
 }
@@ -141,7 +133,7 @@ float Reserva::get_monto() const
  */
 const char* Reserva::get_anotaciones() const 
 {
-    return m_anotaciones;
+    return m_anotaciones.c_str();
 }
 
 /**
@@ -150,11 +142,41 @@ const char* Reserva::get_anotaciones() const
  * Libera la memoria ocupada por los atributos de la clase.
  */
 
-const Fecha *Reserva::get_fecha_salida() const 
+const Fecha& Reserva::get_fecha_salida() const 
 {
     return m_fecha_salida;
 }
 
+Intrusive_Hook<Reserva> Reserva::* Reserva::enlace_alojamiento()
+{
+    return &Reserva::m_enlace_alojamiento;
+}
+
+Intrusive_Hook<Reserva> Reserva::* Reserva::enlace_huesped()
+{
+    return &Reserva::m_enlace_huesped;
+}
+
+/**
+ * @brief Obtiene el alojamiento al que está asignada la reserva.
+ * @return Puntero al alojamiento, o nullptr si no está asignada.
+ */
+Alojamiento* Reserva::get_alojamiento() const
+{
+    return m_alojamiento;
+}
+
+void Reserva::set_alojamiento(Alojamiento* alojamiento)
+{
+    m_alojamiento = alojamiento;
+}
+
+void Reserva::set_fila(Tabla_Reservas* tabla, uint32_t fila)
+{
+    m_tabla = tabla;
+    m_fila = fila;
+}
+
 /**
  * @brief Obtiene el tamaño total en memoria de un objeto Reserva.
  * 
@@ -163,20 +185,19 @@ const Fecha *Reserva::get_fecha_salida() const
 
 size_t Reserva::get_size() const {
     size_t total_size = sizeof(Reserva);
-    total_size += strlen(m_anotaciones) + 1;
-    g_strlen_cnt++;
+    total_size += m_anotaciones.size() + 1;
     return total_size;
 }
 /**
  * @brief Destructor de la clase Reserva.
  * 
- * Libera la memoria ocupada por los atributos de la clase.
+ * Las anotaciones no se liberan aquí: se van con la arena.
  */
 Reserva::~Reserva()
 {
+    m_enlace_alojamiento.desenlazar(this);
+    m_enlace_huesped.desenlazar(this);
+    if (m_tabla != nullptr)
+        m_tabla->eliminar(m_fila);
     g_tamano -= this->get_size();
-    delete m_fecha_entrada;
-    delete m_fecha_pago;
-    delete m_fecha_salida;
-    delete[] m_anotaciones;
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "tabla_reservas.hpp"
+#include <cstring>
+#include "reserva.hpp"
+
+/**
+ * @brief Copia las primeras n posiciones de una columna a un arreglo nuevo y libera el anterior.
+ */
+template <typename T>
+static void mudar_columna(T *&columna, uint32_t n, uint32_t capacidad)
+{
+    T *nueva = new T[capacidad];
+    if (columna != nullptr) {
+        std::memcpy(nueva, columna, n * sizeof(T));
+        g_memcpy_cnt++;
+        delete[] columna;
+    }
+    columna = nueva;
+}
+
+Tabla_Reservas::Tabla_Reservas()
+    : m_entrada(nullptr), m_noches(nullptr), m_reservas(nullptr), m_size(0), m_capacidad(0) {}
+
+Tabla_Reservas::~Tabla_Reservas()
+{
+    clear();
+    delete[] m_entrada;
+    delete[] m_noches;
+    delete[] m_reservas;
+}
+
+void Tabla_Reservas::crecer(uint32_t capacidad)
+{
+    mudar_columna(m_entrada, m_size, capacidad);
+    mudar_columna(m_noches, m_size, capacidad);
+    mudar_columna(m_reservas, m_size, capacidad);
+    m_capacidad = capacidad;
+}
+
+void Tabla_Reservas::reserve(uint32_t n)
+{
+    if (n > m_capacidad)
+        crecer(n);
+}
+
+uint32_t Tabla_Reservas::agregar(Reserva *reserva)
+{
+    if (m_size == m_capacidad)
+        crecer(m_capacidad > 0 ? m_capacidad * 2 : CAPACIDAD_INICIAL_TABLA);
+
+    uint32_t i = m_size++;
+    m_entrada[i] = reserva->get_fecha_entrada().get_dia_serial();
+    m_noches[i] = reserva->get_duracion();
+    m_reservas[i] = reserva;
+    reserva->set_fila(this, i);
+    return i;
+}
+
+/**
+ * @brief La última fila ocupa el hueco y su reserva se entera de su nuevo índice.
+ */
+void Tabla_Reservas::eliminar(uint32_t indice)
+{
+    uint32_t ultima = m_size - 1;
+    m_reservas[indice]->set_fila(nullptr, 0);
+
+    if (indice != ultima) {
+        m_entrada[indice] = m_entrada[ultima];
+        m_noches[indice] = m_noches[ultima];
+        m_reservas[indice] = m_reservas[ultima];
+        m_reservas[indice]->set_fila(this, indice);
+    }
+    m_size--;
+}
+
+void Tabla_Reservas::clear()
+{
+    for (uint32_t i = 0; i < m_size; ++i, g_ciclos++)
+        m_reservas[i]->set_fila(nullptr, 0);
+    m_size = 0;
+}
+
+uint32_t Tabla_Reservas::get_size() const
+{
+    return m_size;
+}
+
+size_t Tabla_Reservas::get_bytes() const
+{
+    return static_cast<size_t>(m_capacidad) * (sizeof(*m_entrada) + sizeof(*m_noches) + sizeof(*m_reservas));
+}